@@ -1,10 +1,10 @@
 #include "bitmap_selector.hpp"
-#include "bufref_json.hpp"
 #include "date_utils.hpp"
+#include "packbits.hpp"
+#include "special_events.hpp"
 
-#include <ArduinoJson.h>
-#include <cstdio>
-#include <vector>
+#include <algorithm>
+#include <cstring>
 
 static const char* const bitmaps_weekdays_day_light[] {
     "survivor_light.bmp",
@@ -49,33 +49,28 @@ static const char* const bitmaps_weekdays_night_dark[] {
 static const char* const regular_pictures_directory = "pictures_regular/";
 static const char* const special_pictures_directory = "pictures_special/";
 
-static char memory_pool[1024];
-static int memory_pool_position = 0;
+static std::optional<BitmapFile> loadGrayBitmap(File bitmap, const char* path) {
+    bitmap.seek(4);
+    uint16_t width = 0;
+    uint16_t height = 0;
+    bitmap.readBytes((char*)&width, 2);
+    bitmap.readBytes((char*)&height, 2);
 
-struct SpecialEvent {
-    DayOfYear doy;
-    const char* bitmap_light = nullptr;
-    const char* bitmap_dark = nullptr;
-};
-
-static std::vector<SpecialEvent> special_days;
-static std::vector<SpecialEvent> special_nights;
-
-static const char* getSpecialBackgroundImageName(DayOfYear doy, bool is_night) {
-    auto is_today = [&](const SpecialEvent& e){ return e.doy == doy; };
-
-    const auto& special_events = is_night ? special_nights : special_days;
-    DisplayMode mode = is_night ? config.night_mode : config.day_mode;
+    if (width > MAX_PICTURE_WIDTH || height > MAX_PICTURE_HEIGHT) {
+        Serial.printf_P(PSTR("Bitmap too big: %s (%d x %d)\n"), path, width, height);
+        return std::nullopt;
+    }
 
-    auto it = std::find_if(special_events.begin(), special_events.end(),
-                            is_today);
-    if (it != special_events.end()) {
-        return mode == DisplayMode::Light
-            ? it->bitmap_light
-            : it->bitmap_dark;
+    uint32_t data_end = 0;
+    bitmap.seek(GRAY_BITMAP_HEADER_SIZE + height * 4);
+    if (bitmap.readBytes((char*)&data_end, 4) != 4 || bitmap.size() < data_end) {
+        Serial.printf_P(PSTR("Bitmap file truncated: %s\n"), path);
+        return std::nullopt;
     }
 
-    return nullptr;
+    return { BitmapFile{.f = std::move(bitmap), .width = width, .height = height,
+                        .data_offset = GRAY_BITMAP_HEADER_SIZE, .row_stride = (width + 7u) / 8,
+                        .top_down = true, .format = BitmapFormat::Gray2} };
 }
 
 std::optional<BitmapFile> loadBitmap(const char* path) {
@@ -87,6 +82,12 @@ std::optional<BitmapFile> loadBitmap(const char* path) {
         return std::nullopt;
     }
 
+    char magic[4]{};
+    bitmap.readBytes(magic, 4);
+    if (memcmp(magic, GRAY_BITMAP_MAGIC, 4) == 0) {
+        return loadGrayBitmap(std::move(bitmap), path);
+    }
+
     if (bitmap.size() < 32) {
         Serial.printf_P(PSTR("File too small to be proper bitmap: %s\n"), path);
         return std::nullopt;
@@ -98,20 +99,18 @@ std::optional<BitmapFile> loadBitmap(const char* path) {
 
     bitmap.seek(18);
     uint32_t width = 0;
-    uint32_t height = 0;
+    int32_t signed_height = 0;
     bitmap.readBytes((char*)&width, 4);
-    bitmap.readBytes((char*)&height, 4);
+    bitmap.readBytes((char*)&signed_height, 4);
+
+    const bool top_down = signed_height < 0;
+    const uint32_t height = top_down ? -signed_height : signed_height;
 
     if (width > MAX_PICTURE_WIDTH || height > MAX_PICTURE_HEIGHT) {
         Serial.printf_P(PSTR("Bitmap too big: %s (%d x %d)\n"), path, width, height);
         return std::nullopt;
     }
 
-    if (width % 16 != 0) {
-        Serial.printf_P(PSTR("Bitmap needs to have width multiple of 16: %s\n"), path);
-        return std::nullopt;
-    }
-
     bitmap.seek(28);
     uint16_t bits_per_pixel = 0;
     bitmap.readBytes((char*)&bits_per_pixel, 2);
@@ -121,30 +120,173 @@ std::optional<BitmapFile> loadBitmap(const char* path) {
         return std::nullopt;
     }
 
-    // TODO: check width, height, bpp, size of the file, alignemt of width to 16
-    // Have meaningful error messages
-    return { BitmapFile{.f = std::move(bitmap), .width = width, .height = height, .data_offset = data_offset} };
+    // Any width is fine, the pictures are blitted at any pixel offset
+    const uint32_t row_stride = (width + 31) / 32 * 4;
+    if (bitmap.size() < data_offset + row_stride * height) {
+        Serial.printf_P(PSTR("Bitmap file truncated: %s\n"), path);
+        return std::nullopt;
+    }
+
+    return { BitmapFile{.f = std::move(bitmap), .width = width, .height = height,
+                        .data_offset = data_offset, .row_stride = row_stride,
+                        .top_down = top_down, .format = BitmapFormat::Mono} };
+}
+
+alignas(4) static uint8_t band_buffers[BITMAP_BAND_SLOTS][BITMAP_BAND_BUFFER_SIZE];
+
+static_assert(BITMAP_BAND_BUFFER_SIZE >= BITMAP_READ_ALIGNMENT + MAX_PICTURE_WIDTH / 8,
+              "Each read has to fit at least one row");
+
+BitmapBandReader::BitmapBandReader(BitmapFile& bmp, int begin_row, int end_row, int slot)
+    : bmp_{bmp}, buffer_{band_buffers[slot]}, buffer_begin_{0}, buffer_end_{0} {
+    // the band is contiguous in the file either way, bottom-up just reversed
+    file_row_     = bmp.top_down ? begin_row : (int)bmp.height - end_row;
+    end_file_row_ = bmp.top_down ? end_row   : (int)bmp.height - begin_row;
+}
+
+const uint8_t* BitmapBandReader::next(int& row) {
+    if (file_row_ >= end_file_row_) {
+        return nullptr;
+    }
+
+    const uint32_t row_begin = bmp_.data_offset + file_row_ * bmp_.row_stride;
+    const uint32_t row_end = row_begin + bmp_.row_stride;
+
+    if (row_begin < buffer_begin_ || row_end > buffer_end_) {
+        const uint32_t band_end = bmp_.data_offset + end_file_row_ * bmp_.row_stride;
+        buffer_begin_ = row_begin / BITMAP_READ_ALIGNMENT * BITMAP_READ_ALIGNMENT;
+        buffer_end_ = std::min<uint32_t>(band_end, buffer_begin_ + BITMAP_BAND_BUFFER_SIZE);
+
+        bmp_.f.seek(buffer_begin_);
+        const size_t read = bmp_.f.readBytes((char*)buffer_, buffer_end_ - buffer_begin_);
+        if (read < row_end - buffer_begin_) {
+            Serial.printf_P(PSTR("Bitmap read failed: %s\n"), bmp_.f.name());
+            buffer_end_ = 0;
+            file_row_ = end_file_row_;
+            return nullptr;
+        }
+        buffer_end_ = buffer_begin_ + read;
+    }
+
+    row = bmp_.top_down ? file_row_ : (int)bmp_.height - 1 - file_row_;
+    ++file_row_;
+    return buffer_ + (row_begin - buffer_begin_);
+}
+
+alignas(4) static uint8_t gray_planes[2][MAX_PICTURE_WIDTH / 8];
+
+static_assert(MAX_PICTURE_WIDTH % 32 == 0, "Gray planes are padded to whole words");
+
+GrayBandReader::GrayBandReader(BitmapFile& bmp, int begin_row, int end_row, int slot)
+    : bmp_{bmp}, buffer_{band_buffers[slot]}, row_{begin_row}, end_row_{end_row},
+      position_{0}, end_{0}, buffered_{0}, consumed_{0} {
+    // the compressed band is contiguous, between the offsets of its first and past-the-end rows
+    bmp.f.seek(bmp.data_offset + begin_row * 4);
+    bmp.f.readBytes((char*)&position_, 4);
+    bmp.f.seek(bmp.data_offset + end_row * 4);
+    bmp.f.readBytes((char*)&end_, 4);
+}
+
+int GrayBandReader::readByte() {
+    if (consumed_ == buffered_) {
+        if (position_ >= end_) {
+            return -1;
+        }
+
+        // the first read of the band might start in the middle of a page
+        const uint32_t page_end = (position_ / BITMAP_READ_ALIGNMENT + 1) * BITMAP_READ_ALIGNMENT;
+        const uint32_t wanted = std::min<uint32_t>(end_ - position_,
+            BITMAP_BAND_BUFFER_SIZE - BITMAP_READ_ALIGNMENT + (page_end - position_));
+
+        bmp_.f.seek(position_);
+        buffered_ = bmp_.f.readBytes((char*)buffer_, wanted);
+        consumed_ = 0;
+        position_ += buffered_;
+        if (buffered_ == 0) {
+            position_ = end_;
+            return -1;
+        }
+    }
+
+    return buffer_[consumed_++];
+}
+
+bool GrayBandReader::next(int& row, const uint8_t*& high_plane, const uint8_t*& low_plane) {
+    if (row_ >= end_row_) {
+        return false;
+    }
+
+    // the high plane and then the low one, packed together
+    const int stride = bmp_.row_stride;
+    const bool complete = unpackBits(
+        [this] { return readByte(); },
+        [stride](size_t i, uint8_t value) { gray_planes[i / stride][i % stride] = value; },
+        2 * stride);
+
+    if (!complete) {
+        Serial.printf_P(PSTR("Bitmap data truncated: %s\n"), bmp_.f.name());
+        row_ = end_row_;
+        return false;
+    }
+
+    row = row_++;
+    high_plane = gray_planes[0];
+    low_plane = gray_planes[1];
+    return true;
+}
+
+// Memoized selection, the file stays open while the choice can't change
+struct CachedBackground {
+    std::optional<BitmapFile> bitmap;
+    long valid_from = 0;    // local minutes since epoch
+    long valid_until = 0;   // exclusive
+};
+
+static CachedBackground background_cache;
+
+static long localMinutesSinceEpoch(const struct tm& t) {
+    return daysFromCivil(t.tm_year + 1900, t.tm_mon + 1, t.tm_mday) * 24 * 60
+           + t.tm_hour * 60 + t.tm_min;
+}
+
+// The picture depends only on the side of wakeup/sleep time and on the date
+// (shifted to yesterday before wakeup), so it can change only at these times
+static long nextBackgroundChange(const struct tm& now) {
+    const int minutes_into_day = now.tm_hour * 60 + now.tm_min;
+
+    int next_change = 24 * 60;  // midnight
+    for (int boundary : { config.wakeup_time, config.sleep_time }) {
+        if (boundary > minutes_into_day && boundary < next_change) {
+            next_change = boundary;
+        }
+    }
+
+    return localMinutesSinceEpoch(now) - minutes_into_day + next_change;
 }
 
-std::optional<BitmapFile> getBackgroundImage(struct tm now) {
+static std::optional<BitmapFile> selectBackgroundImage(struct tm now) {
     int minutes_into_day = now.tm_hour * 60 + now.tm_min;
 
+    // no-op unless the year changed, keeps the lookup below constant-time
+    const int calendar_year = now.tm_year;
+    prepareSpecialEvents(calendar_year + 1900);
+
     bool is_night = minutes_into_day < config.wakeup_time || minutes_into_day >= config.sleep_time;
     if (minutes_into_day < config.wakeup_time) {
         // the slugcat from the previous day is still sleeping, adjust date to yesterday
-        now.tm_mday -= 1;
-        mktime(&now); // normalize the date
+        stepBackOneDay(now);
     }
 
     int weekday = (now.tm_wday + 6) % 7; // monday == 0
-    DayOfYear doy = DayOfYear{now};
+    DayOfYear doy = now.tm_year == calendar_year ? DayOfYear{now} : PREVIOUS_YEAR_LAST_DAY;
     const char* bitmap_name;
     const char* directory;
 
-    const char* special_bitmap;
-    if (special_bitmap = getSpecialBackgroundImageName(doy, is_night)) {
+    const DisplayMode mode = is_night ? config.night_mode : config.day_mode;
+    const AssetId special_bitmap = getSpecialBackgroundAsset(doy, is_night, mode);
+    if (special_bitmap != NO_ASSET) {
         directory = special_pictures_directory;
-        bitmap_name = special_bitmap;
+        bitmap_name = getSpecialAssetName(special_bitmap);
     } else {
         directory = regular_pictures_directory;
         bitmap_name = is_night
@@ -164,71 +306,24 @@ std::optional<BitmapFile> getBackgroundImage(struct tm now) {
     return loadBitmap(path_buffer);
 }
 
-static const char* loadNameToPool(const char* name) {
-    if (name == nullptr) {
-        return nullptr;
-    }
-
-    // TODO How to handle / report these errors?
-    int len = strlen(name);
-    if (memory_pool_position + len + 1 >= sizeof(memory_pool)) {
-        return nullptr;
-    }
-
-    if (len >= LFS_NAME_MAX) {
-        return nullptr;
-    }
-
-    memcpy(memory_pool + memory_pool_position, name, len + 1);
-
-    const char* result = memory_pool + memory_pool_position;
-    memory_pool_position += len + 1;
-    return result;
-}
-
-static void readSpecialBitmapsFile(const char* file, std::vector<SpecialEvent>& out) {
-    File special_events_file = LittleFS.open(file, "r");
-
-    if (!special_events_file) {
-        Serial.printf_P(PSTR("Can't open special bitmaps file\n"));
-        return;
-    }
-
-    BufRefJsonDocument doc((char*)getDisplayBuffer(), DISPLAY_BUFFER_SIZE);
-    DeserializationError error = deserializeJson(doc, special_events_file);
-    special_events_file.close();
-
-    if (error) {
-        Serial.printf_P(PSTR("Can't load special bitmaps JSON\n"));
-        return;
+BitmapFile* getBackgroundImage(const struct tm& now) {
+    const long minutes = localMinutesSinceEpoch(now);
+
+    // also handles the clock going back, e.g. after an NTP correction
+    if (minutes < background_cache.valid_from || minutes >= background_cache.valid_until) {
+        background_cache.bitmap.reset();    // close the previous file first
+        background_cache.bitmap = selectBackgroundImage(now);
+        background_cache.valid_from = minutes;
+        // a missing picture is retried in a minute, it might be uploaded
+        background_cache.valid_until = background_cache.bitmap
+            ? nextBackgroundChange(now)
+            : minutes + 1;
     }
 
-    const JsonObjectConst event_map = doc.as<JsonObjectConst>();
-    out.reserve(event_map.size());
-
-    for (const auto& event : event_map) {
-        int day = 0, month = 0;
-        sscanf(event.key().c_str(), "%2d/%2d", &day, &month);
-        if (day < 1 || day > 31 || month < 1 || month > 12) {
-            // Either parsing failed or a non-logical value
-            Serial.printf_P(PSTR("Can't parse event date: %s\n"), event.key().c_str());
-            continue;
-        }
-
-        out.push_back(SpecialEvent{
-            .doy = DayOfYear(month, day),
-            .bitmap_light = loadNameToPool(event.value()["light"].as<const char*>()),
-            .bitmap_dark = loadNameToPool(event.value()["dark"].as<const char*>())
-        });
-
-        Serial.printf_P(PSTR("Loaded special event: %d/%d: (%s, %s)\n"),
-            day, month,
-            out.back().bitmap_light ?: "",
-            out.back().bitmap_dark ?: "");
-    }
+    return background_cache.bitmap ? &*background_cache.bitmap : nullptr;
 }
 
-void readSpecialBitmapsConfig() {
-    readSpecialBitmapsFile("special_days.json", special_days);
-    readSpecialBitmapsFile("special_nights.json", special_nights);
+void invalidateBackgroundImage() {
+    background_cache.bitmap.reset();
+    background_cache.valid_until = 0;
 }
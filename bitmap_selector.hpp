@@ -8,15 +8,84 @@
 #include <optional>
 #include <LittleFS.h>
 
+// Besides 1bpp BMP files, pictures can be stored as 2bpp gray levels, dithered
+// when drawn. Such a file starts with GRAY_BITMAP_MAGIC, then the width and
+// height (uint16_t each) and the file offsets of the rows (uint32_t, height + 1),
+// the last one being the end of the data. The rows are top-down, each row is
+// PackBits compressed and holds two bit planes, the high bits of the levels
+// and then the low bits, (width + 7) / 8 bytes each. Level 0 is black, 3 white.
+enum class BitmapFormat : uint8_t {
+    Mono,
+    Gray2
+};
+
+constexpr char GRAY_BITMAP_MAGIC[4] = { 'R', 'W', 'G', '2' };
+constexpr int GRAY_BITMAP_HEADER_SIZE = 8;
+
 struct BitmapFile {
     File f;
     uint32_t width;
     uint32_t height;
-    uint32_t data_offset;
+    uint32_t data_offset;   // the row offsets for gray pictures
+    uint32_t row_stride;    // rows in BMP files are padded to 4 bytes, gray planes to bytes
+    bool top_down;          // negative height in the header, usually rows go bottom-up
+    BitmapFormat format;
+};
+
+constexpr int BITMAP_BAND_SLOTS = 2;          // a picture and its mask
+constexpr int BITMAP_BAND_BUFFER_SIZE = 1024;  // per slot
+constexpr int BITMAP_READ_ALIGNMENT = 256;     // LittleFS page size
+
+// Reads a band of picture rows with a few large reads, aligned to the
+// file system pages. LittleFS has a considerable overhead per call.
+// Readers share static buffers, only one reader per slot can be used at a time.
+class BitmapBandReader {
+  public:
+    // Picture rows [begin_row, end_row), counted from the top
+    BitmapBandReader(BitmapFile& bmp, int begin_row, int end_row, int slot = 0);
+
+    // The next row of the band in the file order, nullptr after the last one.
+    // `row` is set to the row number from the top of the picture.
+    const uint8_t* next(int& row);
+
+  private:
+    BitmapFile& bmp_;
+    uint8_t* buffer_;
+    int file_row_;          // rows counted in the file order
+    int end_file_row_;
+    uint32_t buffer_begin_; // file offsets of the buffered bytes
+    uint32_t buffer_end_;
+};
+
+// Decompresses a band of rows of a gray picture, reading the compressed
+// data in large chunks through a slot of the BitmapBandReader buffers.
+class GrayBandReader {
+  public:
+    // Picture rows [begin_row, end_row), counted from the top
+    GrayBandReader(BitmapFile& bmp, int begin_row, int end_row, int slot = 0);
+
+    // Planes of the next row, false after the last one. The planes are aligned
+    // to 4 bytes and padded to whole words, valid until the next call.
+    bool next(int& row, const uint8_t*& high_plane, const uint8_t*& low_plane);
+
+  private:
+    int readByte();
+
+    BitmapFile& bmp_;
+    uint8_t* buffer_;
+    int row_;
+    int end_row_;
+    uint32_t position_;     // file offsets of the compressed data
+    uint32_t end_;
+    int buffered_;
+    int consumed_;
 };
 
 std::optional<BitmapFile> loadBitmap(const char* path);
-std::optional<BitmapFile> getBackgroundImage(struct tm now);
-void readSpecialBitmapsConfig();
+// The returned file is owned by the selector and stays open (and valid)
+// until the next instant the picture can change: wakeup, sleep or midnight
+BitmapFile* getBackgroundImage(const struct tm& now);
+// To be called when the config or special events change
+void invalidateBackgroundImage();
 
 #endif  // RWCLOCK_BITMAP_SELECTOR_HPP_
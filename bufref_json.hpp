@@ -1,8 +1,11 @@
 #ifndef RWCLOCK_BUFREF_JSON_HPP_
 #define RWCLOCK_BUFREF_JSON_HPP_
 
+#include <Arduino.h>
 #include <ArduinoJson.h>
 
+#include "scratch_arena.hpp"
+
 class BufRefJsonDocument : public ArduinoJson::JsonDocument {
   public:
     BufRefJsonDocument(char* buf, size_t capacity) : JsonDocument(buf, capacity) {}
@@ -14,4 +17,33 @@ class BufRefJsonDocument : public ArduinoJson::JsonDocument {
     BufRefJsonDocument& operator=(BufRefJsonDocument&&) = delete;
 };
 
+// The block is a base, so it's taken before the document is built on it
+struct ScratchJsonMemory {
+    ScratchBlock scratch_block;
+};
+
+// A document in the scratch arena for its scope, in all that is left of it
+// without a capacity. The memory used counts towards the high-water mark.
+class ScratchJsonDocument : private ScratchJsonMemory, public BufRefJsonDocument {
+  public:
+    ScratchJsonDocument()
+        : BufRefJsonDocument((char*)scratch_block.data(), scratch_block.size()) {}
+    explicit ScratchJsonDocument(size_t capacity)
+        : ScratchJsonMemory{ ScratchBlock(capacity) },
+          BufRefJsonDocument((char*)scratch_block.data(), scratch_block.size()) {}
+    ~ScratchJsonDocument() { scratch_block.recordUsage(memoryUsage()); }
+};
+
+// Reports why `source` wasn't parsed, telling a document too big for the
+// scratch arena from a malformed one
+inline void printJsonError(const char* source, DeserializationError error) {
+    if (error == DeserializationError::NoMemory) {
+        Serial.printf_P(PSTR("%s doesn't fit in the %u bytes of the scratch arena\n"),
+                        source, (unsigned)SCRATCH_ARENA_SIZE);
+        return;
+    }
+    Serial.printf_P(PSTR("%s can't be parsed: "), source);
+    Serial.println(error.f_str());
+}
+
 #endif  // RWCLOCK_BUFREF_JSON_HPP_
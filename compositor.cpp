@@ -0,0 +1,104 @@
+#include "compositor.hpp"
+#include "raster_ops.hpp"
+
+#include <algorithm>
+#include <optional>
+
+static bool maskFits(const BitmapFile& image, const BitmapFile& mask) {
+    return image.width == mask.width && image.height == mask.height
+           && image.top_down == mask.top_down;
+}
+
+static void compositeLayer(const Layer& layer, int current_page, const Palette& palette) {
+    BitmapFile& image = *layer.image;
+    unsigned char* display_buffer = getDisplayBuffer();
+
+    const int begin_draw_row = current_page * PAGE_HEIGHT;
+    const int end_draw_row   = (current_page + 1) * PAGE_HEIGHT;
+
+    const int begin_copy_row = std::max(begin_draw_row, layer.y0);
+    const int end_copy_row   = std::min(end_draw_row, layer.y0 + (int)image.height);
+
+    const int begin_copy_col = std::max(0, layer.x0);
+    const int end_copy_col   = std::min(WIDTH, layer.x0 + (int)image.width);
+
+    if (begin_copy_row >= end_copy_row || begin_copy_col >= end_copy_col) {
+        return;
+    }
+
+    BitmapFile* mask = layer.mask;
+    if (mask && !maskFits(image, *mask)) {
+        Serial.printf_P(PSTR("Mask doesn't match its picture: %s\n"), mask->f.name());
+        mask = nullptr;
+    }
+
+    // Gray pictures are dithered inverted on the dark palette,
+    // so one picture works for both, and are then blitted as they are
+    const bool gray = image.format == BitmapFormat::Gray2;
+    const bool dark = palette.background_color != GxEPD_WHITE;
+    const bool blit_invert = !gray && layer.invert;
+
+    BlitMode mode;
+    if (mask) {
+        mode = blit_invert ? BlitMode::CopyNot : BlitMode::Copy;
+    } else {
+        mode = !dark       ? BlitMode::And
+             : blit_invert ? BlitMode::OrNot
+                           : BlitMode::Or;
+    }
+
+    const int begin_row = begin_copy_row - layer.y0;
+    const int end_row = end_copy_row - layer.y0;
+    const int src_x = begin_copy_col - layer.x0;
+    const int width = end_copy_col - begin_copy_col;
+
+    // same size and row order, so the mask goes row by row along the picture
+    std::optional<BitmapBandReader> mask_band;
+    if (mask) {
+        mask_band.emplace(*mask, begin_row, end_row, 1);
+    }
+
+    auto drawRow = [&](int row_in_image, const uint8_t* row) {
+        unsigned char* row_buffer
+            = display_buffer + WIDTH / 8 * ((layer.y0 + row_in_image) % PAGE_HEIGHT);
+
+        if (!mask_band) {
+            blitRow(row_buffer, begin_copy_col, row, src_x, width, mode);
+            return true;
+        }
+
+        int row_in_mask = 0;
+        const uint8_t* mask_row = mask_band->next(row_in_mask);
+        if (!mask_row) {
+            return false;
+        }
+        blitRowMasked(row_buffer, begin_copy_col, row, mask_row, src_x, width, mode);
+        return true;
+    };
+
+    int row_in_image = 0;
+    if (gray) {
+        alignas(4) static uint8_t dithered[MAX_PICTURE_WIDTH / 8];
+        GrayBandReader band(image, begin_row, end_row, 0);
+        const uint8_t* high_plane = nullptr;
+        const uint8_t* low_plane = nullptr;
+        while (band.next(row_in_image, high_plane, low_plane)) {
+            ditherGrayRow(dithered, high_plane, low_plane, image.width,
+                          layer.x0, layer.y0 + row_in_image, dark);
+            if (!drawRow(row_in_image, dithered)) return;
+        }
+    } else {
+        BitmapBandReader band(image, begin_row, end_row, 0);
+        while (const uint8_t* row = band.next(row_in_image)) {
+            if (!drawRow(row_in_image, row)) return;
+        }
+    }
+}
+
+void compositeLayers(const Layer* layers, int count, int current_page, const Palette& palette) {
+    for (int i = 0; i < count; ++i) {
+        if (layers[i].image) {
+            compositeLayer(layers[i], current_page, palette);
+        }
+    }
+}
@@ -0,0 +1,25 @@
+#ifndef RWCLOCK_COMPOSITOR_HPP_
+#define RWCLOCK_COMPOSITOR_HPP_
+
+#include "bitmap_selector.hpp"
+#include "display.hpp"
+
+// A picture placed on the screen. Without a mask the background color of
+// the palette is transparent, like the pictures were always drawn.
+// With a mask, its white pixels are opaque and its black ones transparent,
+// so the layer covers whatever was drawn underneath, in both palettes.
+// Gray pictures are dithered, with inverted levels on the dark palette,
+// `invert` only applies to 1bpp pictures.
+struct Layer {
+    BitmapFile* image = nullptr;
+    BitmapFile* mask = nullptr;     // the same size and row order as the image
+    int x0 = 0;                     // top left corner on the screen
+    int y0 = 0;
+    bool invert = false;
+};
+
+// Draws the layers over the current page, in order, later layers on top.
+// Each layer reads only its rows within the page, in one pass.
+void compositeLayers(const Layer* layers, int count, int current_page, const Palette& palette);
+
+#endif  // RWCLOCK_COMPOSITOR_HPP_
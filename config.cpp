@@ -1,6 +1,7 @@
 #include "config.hpp"
 #include "bufref_json.hpp"
-#include "display.hpp"
+#include "memory_stats.hpp"
+#include "snapshot.hpp"
 
 #include "LittleFS.h"
 #include "ArduinoJson.h"
@@ -9,6 +10,12 @@ UserConfiguration config;
 
 static constexpr int WPA_KEY_MIN_LENGTH = 8;
 
+static constexpr char CONFIG_PATH[] = "config.json";
+static constexpr char CONFIG_SNAPSHOT_PATH[] = "config.bin";
+static constexpr uint16_t CONFIG_SNAPSHOT_VERSION = 1;   // bump when UserConfiguration changes meaning
+
+static SourceStamp config_stamp{};     // of the config.json read last
+
 static const char* readJsonElementText(const JsonDocument& doc, const char* key) {
   const char* value = doc[key].as<const char*>();
   if (value == nullptr) {
@@ -52,36 +59,37 @@ static bool readJsonElementBoolean(const JsonDocument& doc, const char* key) {
   return value;
 }
 
-void readConfig() {
-  File config_file = LittleFS.open("config.json", "r");
+// Returns false if the config is incomplete or invalid, what was read is kept
+static bool parseConfig() {
+  File config_file = LittleFS.open(CONFIG_PATH, "r");
 
   if (!config_file) {
     Serial.printf_P(PSTR("Can't open config file\n"));
-    return;
+    return false;
   }
 
 
-  BufRefJsonDocument doc((char*)getDisplayBuffer(), DISPLAY_BUFFER_SIZE);
+  ScratchJsonDocument doc;
   DeserializationError error = deserializeJson(doc, config_file);
   config_file.close();
 
   if (error) {
-    Serial.printf_P(PSTR("Can't load config\n"));
-    return;
+    printJsonError(CONFIG_PATH, error);
+    return false;
   }
 
   const char* wifi_ssid = readJsonElementText(doc, "wifi_ssid");
   if (!wifi_ssid) {
-    return;
+    return false;
   }
   strlcpy(config.wifi_ssid, wifi_ssid, sizeof(config.wifi_ssid));
 
   const char* wifi_password = readJsonElementText(doc, "wifi_password");
   if (!wifi_password) {
-    return;
+    return false;
   }
   if (strlen(wifi_password) < WPA_KEY_MIN_LENGTH) {
-    return;
+    return false;
   }
   strlcpy(config.wifi_password, wifi_password, sizeof(config.wifi_password));
 
@@ -115,6 +123,63 @@ void readConfig() {
   config.night_mode = readJsonElementBoolean(doc, "night_dark_mode")
     ? DisplayMode::Dark
     : DisplayMode::Light;
+
+  return true;
+}
+
+bool readConfig() {
+  MemoryProbe probe(MemoryUser::Config);
+
+  static const char* const sources[] = { CONFIG_PATH };
+  const SnapshotChunk chunks[] = { { &config, sizeof(config) } };
+
+  config_stamp = stampOf(CONFIG_PATH);
+
+  if (loadSnapshot(CONFIG_SNAPSHOT_PATH, CONFIG_SNAPSHOT_VERSION, sources, 1, chunks, 1)) {
+    Serial.printf_P(PSTR("Config loaded from snapshot\n"));
+    return true;
+  }
+
+  // only valid configs are kept, so the errors of the others show up at every boot
+  if (!parseConfig()) {
+    return false;
+  }
+  saveSnapshot(CONFIG_SNAPSHOT_PATH, CONFIG_SNAPSHOT_VERSION, sources, 1, chunks, 1);
+  return true;
+}
+
+ConfigChanges reloadConfigIfChanged() {
+  ConfigChanges changes;
+  if (stampOf(CONFIG_PATH) == config_stamp) {
+    return changes;
+  }
+
+  Serial.printf_P(PSTR("Config file changed, reloading\n"));
+
+  const UserConfiguration previous = config;
+  config = UserConfiguration{};
+  if (!readConfig()) {
+    // e.g. in the middle of an upload, it's retried when the file changes again
+    config = previous;
+    return changes;
+  }
+
+  // not from the file, but found out at runtime
+  config.skip_weather_data = previous.skip_weather_data;
+  if (!config.manual_timezone && !previous.manual_timezone) {
+    strlcpy(config.timezone, previous.timezone, sizeof(config.timezone));
+  }
+
+  changes.wifi = strcmp(config.wifi_ssid, previous.wifi_ssid) != 0
+                 || strcmp(config.wifi_password, previous.wifi_password) != 0;
+  changes.timezone = strcmp(config.timezone, previous.timezone) != 0
+                     || config.manual_timezone != previous.manual_timezone;
+  changes.location = strcmp(config.location, previous.location) != 0;
+  changes.schedule = config.wakeup_time != previous.wakeup_time
+                     || config.sleep_time != previous.sleep_time;
+  changes.display_modes = config.day_mode != previous.day_mode
+                          || config.night_mode != previous.night_mode;
+  return changes;
 }
 
 DisplayMode getCurrentDisplayMode(const tm & now)
@@ -3,7 +3,8 @@
 
 #include <wl_definitions.h>
 
-constexpr const char day_api[] PROGMEM = "http://d1ox7ijvdplfv4.cloudfront.net";
+constexpr const char day_api_host[] PROGMEM = "d1ox7ijvdplfv4.cloudfront.net";
+constexpr unsigned short day_api_port = 80;
 
 constexpr int HEIGHT = 480;
 constexpr int WIDTH = 800;
@@ -53,7 +54,24 @@ struct UserConfiguration {
 
 extern UserConfiguration config;
 
-void readConfig();
+// What reloadConfigIfChanged() found different, so only that is re-applied
+struct ConfigChanges {
+    bool wifi = false;          // the SSID or the password
+    bool timezone = false;
+    bool location = false;
+    bool schedule = false;      // the wakeup or the sleep time
+    bool display_modes = false; // of the day or the night
+
+    bool any() const { return wifi || timezone || location || schedule || display_modes; }
+};
+
+// Returns false if the config is missing or invalid
+bool readConfig();
+
+// Reads config.json again if its size or modification time changed since
+// it was last read. An invalid file leaves the config as it was.
+ConfigChanges reloadConfigIfChanged();
+
 DisplayMode getCurrentDisplayMode(const struct tm&);
 
 int clock_x0();
@@ -1,8 +1,10 @@
 #include "connection.hpp"
 #include "bufref_json.hpp"
 #include "config.hpp"
-#include "display.hpp"
+#include "http_session.hpp"
+#include "memory_stats.hpp"
 #include "meteo.hpp"
+#include "timezone_rules.hpp"
 
 #include <ArduinoJson.h>
 #include <ESP8266WiFi.h>
@@ -10,11 +12,24 @@
 #include <ESP8266HTTPClient.h>
 
 #include <ctime>
+#include <iterator>
 
 static ESP8266WiFiMulti WiFiMulti;
+static HttpSession server_session;
 static char day_query[80] = "";
 
+// Fields of the day data response read by updateLocalDataFromServer()
+static const char* const server_fields[] = {
+    "tz", "timestamp", "is_day", "location", "sunrise", "sunset",
+    "current_temp_c", "current_condition_code",
+    "today_max_temp_c", "today_condition_code", "today_min_temp_c",
+    "tomorrow_max_temp_c", "tomorrow_condition_code",
+};
+static constexpr size_t SERVER_FILTER_CAPACITY = JSON_OBJECT_SIZE(std::size(server_fields));
+
 void connectToWiFi() {
+  MemoryProbe probe(MemoryUser::WiFi);
+
   WiFi.mode(WIFI_STA);
   WiFiMulti.addAP(config.wifi_ssid, config.wifi_password);
 
@@ -30,6 +45,12 @@ void connectToWiFi() {
   }
 }
 
+void reconnectToWiFi() {
+  WiFiMulti.cleanAPlist();
+  WiFi.disconnect();
+  connectToWiFi();
+}
+
 void configNTP() {
     Serial.println(F("[NTP] Updating NTP config"));
 
@@ -37,13 +58,13 @@ void configNTP() {
         Serial.println(F("[NTP] Time updated"));
     });
 
+    // The system clock is kept in UTC, local time is computed by the TZ engine.
     // These addresses are not copied, they need to be in static memory!
-    configTime(config.timezone, "pool.ntp.org", "time.nist.gov", "time.google.com");
+    configTime(0, 0, "pool.ntp.org", "time.nist.gov", "time.google.com");
 }
 
 static void createQuery() {
     day_query[0] = '\0';
-    strcat_P(day_query, day_api);
     strcat_P(day_query, PSTR("/?q="));
 
     //strlcat(day_query, config.location, sizeof(day_query));
@@ -92,6 +113,8 @@ static void createQuery() {
 }
 
 void updateLocalDataFromServer() {
+    MemoryProbe probe(MemoryUser::DayData);
+
     config.skip_weather_data = true;
 
     if (config.location[0] == '\0') {
@@ -107,38 +130,39 @@ void updateLocalDataFromServer() {
         return;
     }
 
-    HTTPClient http;
-    WiFiClient wifiClient;
-    http.useHTTP10(true);
     Serial.println(F("Connecting with day data server..."));
     Serial.printf_P(PSTR("[HTTP] query: %s\n"), day_query);
 
-    Serial.println(F("[HTTP] begin..."));
+    char host[sizeof(day_api_host)];
+    strlcpy_P(host, day_api_host, sizeof(host));
 
-    if (!http.begin(wifiClient, day_query)) {
-        Serial.println(F("[HTTP] Unable to connect"));
-        return;
-    }
-
-    int httpCode = http.GET();
+    int httpCode = server_session.get(host, day_api_port, day_query);
 
     // httpCode will be negative on error
     if (httpCode != HTTP_CODE_OK) {
         Serial.printf_P(PSTR("[HTTP] GET... failed, error: %d %s\n"),
                       httpCode,
-                      http.errorToString(httpCode).c_str());
+                      HTTPClient::errorToString(httpCode).c_str());
+        server_session.close();
         return;
     }
     // HTTP header has been send and Server response header has been handled
     Serial.printf_P(PSTR("[HTTP] GET successful, code: %d\n"), httpCode);
 
-    BufRefJsonDocument doc((char*)getDisplayBuffer(), DISPLAY_BUFFER_SIZE);
-    DeserializationError error = deserializeJson(doc, http.getStream());
-    http.end();
+    // Only the fields used are kept, the rest of the response takes no memory
+    ScratchJsonDocument filter(SERVER_FILTER_CAPACITY);
+    for (const char* field : server_fields) {
+        filter[field] = true;
+    }
+
+    // The body (chunked or not) is decoded by the session while parsing
+    ScratchJsonDocument doc;
+    DeserializationError error = deserializeJson(doc, server_session,
+                                                 DeserializationOption::Filter(filter));
+    server_session.close();
 
     if (error) {
-        Serial.print(F("deserializeJson() failed: "));
-        Serial.println(error.f_str());
+        printJsonError("Server response", error);
         return;
     }
 
@@ -147,7 +171,7 @@ void updateLocalDataFromServer() {
         && !config.manual_timezone // automatic timezone mode
         && strcmp(tz, config.timezone) != 0) { // there was a change (DST?)
         strlcpy(config.timezone, tz, sizeof(config.timezone));
-        configNTP();
+        setTimezone(config.timezone);
 
         Serial.printf_P(PSTR("Timezone changed to: %s\n"), config.timezone);
     }
@@ -198,6 +222,10 @@ void updateLocalDataFromServer() {
     config.skip_weather_data = false;
 }
 
+void invalidateServerQuery() {
+    day_query[0] = '\0';
+}
+
 bool waitForNTPUpdate(unsigned long ms_timeout)
 {
     static constexpr time_t START_OF_YEAR_2024 = 1704067200;
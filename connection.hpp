@@ -4,8 +4,12 @@
 #include <optional>
 
 void connectToWiFi();
+// Drops the current network, and connects with the SSID from the config
+void reconnectToWiFi();
 void configNTP();
 void updateLocalDataFromServer();
+// The query is built again from the config location by the next update
+void invalidateServerQuery();
 bool waitForNTPUpdate(unsigned long timeout_ms = 5000);
 
 #endif  // RWCLOCK_CONNECTION_HPP_
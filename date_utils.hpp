@@ -1,6 +1,8 @@
 #ifndef RWCLOCK_DAY_UTILS_HPP_
 #define RWCLOCK_DAY_UTILS_HPP_
 
+#include <ctime>
+
 extern "C"
 int _gettimeofday_r(struct _reent* unused, struct timeval *tp, void *tzp);
 
@@ -13,4 +15,74 @@ struct DayOfYear {
     bool operator==(const DayOfYear& other) const { return day == other.day; };
 };
 
+constexpr bool isLeapYear(int year) {
+    return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+}
+
+// Days since 1970-01-01 of a proleptic Gregorian date, month in 1..12
+// Howard Hinnant's days_from_civil, works without any timezone or libc state
+constexpr long daysFromCivil(int year, int month, int day) {
+    year -= month <= 2;
+    const long era = (year >= 0 ? year : year - 399) / 400;
+    const long yoe = year - era * 400;
+    const long doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const long doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+struct CivilDate {
+    int year;
+    int month;  // 1..12
+    int day;
+};
+
+// Inverse of daysFromCivil
+constexpr CivilDate civilFromDays(long days) {
+    days += 719468;
+    const long era = (days >= 0 ? days : days - 146096) / 146097;
+    const long doe = days - era * 146097;
+    const long yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const long doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const long mp = (5 * doy + 2) / 153;
+    const int day = (int)(doy - (153 * mp + 2) / 5 + 1);
+    const int month = (int)(mp < 10 ? mp + 3 : mp - 9);
+    return CivilDate{ (int)(yoe + era * 400) + (month <= 2), month, day };
+}
+
+// 0 == Sunday, same as tm_wday
+constexpr int weekdayFromDays(long days) {
+    return (int)(((days + 4) % 7 + 7) % 7);
+}
+
+// Days since epoch of the n-th given weekday of the month, week 5 means the last one
+constexpr long nthWeekdayOfMonth(int year, int month, int weekday, int week) {
+    const long first = daysFromCivil(year, month, 1);
+    const long next_month = month == 12
+        ? daysFromCivil(year + 1, 1, 1)
+        : daysFromCivil(year, month + 1, 1);
+
+    long day = first + (weekday - weekdayFromDays(first) + 7) % 7 + (week - 1) * 7;
+    while (day >= next_month) day -= 7;
+    return day;
+}
+
+// Moves the date one day back, keeping tm_wday and tm_yday consistent.
+// A replacement for "tm_mday -= 1; mktime()", which would reparse TZ.
+inline void stepBackOneDay(struct tm& t) {
+    if (t.tm_mday > 1) {
+        t.tm_mday -= 1;
+    } else if (t.tm_mon > 0) {
+        t.tm_mon -= 1;
+        t.tm_mday = (int)(daysFromCivil(t.tm_year + 1900, t.tm_mon + 2, 1)
+                        - daysFromCivil(t.tm_year + 1900, t.tm_mon + 1, 1));
+    } else {
+        t.tm_year -= 1;
+        t.tm_mon = 11;
+        t.tm_mday = 31;
+    }
+
+    t.tm_wday = (t.tm_wday + 6) % 7;
+    t.tm_yday = t.tm_yday > 0 ? t.tm_yday - 1 : (isLeapYear(t.tm_year + 1900) ? 365 : 364);
+}
+
 #endif  // RWCLOCK_DAY_UTILS_HPP_
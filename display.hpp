@@ -22,7 +22,7 @@ static_assert(DisplayType::HEIGHT == HEIGHT);
 // http://bloglitb.blogspot.com/2010/07/access-to-private-members-thats-easy.html
 
 // It is a *very* dirty trick to get to the private buffer of display,
-// both for manual management and usage as a different purpose buffer
+// for manual management of the pages
 template<typename Tag>
 struct result {
     /* export it ... */
@@ -0,0 +1,88 @@
+#include "display_list.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+static ScreenRect clipToScreen(int x0, int y0, int x1, int y1) {
+    return ScreenRect{ (int16_t)std::clamp(x0, 0, (int)WIDTH),
+                       (int16_t)std::clamp(y0, 0, (int)HEIGHT),
+                       (int16_t)std::clamp(x1, 0, (int)WIDTH),
+                       (int16_t)std::clamp(y1, 0, (int)HEIGHT) };
+}
+
+DrawOp fillOp(ScreenRect rect, const RowPattern& pattern, BlitMode mode,
+              uint8_t row_step, uint8_t row_phase) {
+    DrawOp op;
+    op.type = DrawOpType::Fill;
+    op.bounds = clipToScreen(rect.x0, rect.y0, rect.x1, rect.y1);
+    op.fill = FillOp{ pattern, mode, row_step, row_phase };
+    return op;
+}
+
+static DrawOp circleOp(DrawOpType type, int x0, int y0, int r, unsigned short color) {
+    DrawOp op;
+    op.type = type;
+    op.bounds = clipToScreen(x0 - r, y0 - r, x0 + r + 1, y0 + r + 1);
+    op.circle = CircleOp{ (int16_t)x0, (int16_t)y0, (int16_t)r, color };
+    return op;
+}
+
+DrawOp discOp(int x0, int y0, int r, unsigned short color) {
+    return circleOp(DrawOpType::Disc, x0, y0, r, color);
+}
+
+DrawOp ringOp(int x0, int y0, int r, unsigned short color) {
+    return circleOp(DrawOpType::Ring, x0, y0, r, color);
+}
+
+DrawOp pictureOp(const Layer& layer) {
+    DrawOp op;
+    op.type = DrawOpType::Picture;
+    op.bounds = clipToScreen(layer.x0, layer.y0,
+                             layer.x0 + (int)layer.image->width,
+                             layer.y0 + (int)layer.image->height);
+    op.picture = PictureOp{ layer.image, layer.mask,
+                            (int16_t)layer.x0, (int16_t)layer.y0, layer.invert };
+    return op;
+}
+
+DrawOp textOp(const TextLayout& layout, int x, int y, unsigned short color) {
+    DrawOp op;
+    op.type = DrawOpType::Text;
+    op.bounds = clipToScreen(x + layout.x1, y + layout.y1,
+                             x + layout.x1 + layout.w, y + layout.y1 + layout.h);
+    op.text = TextOp{ &layout, (int16_t)x, (int16_t)y, color };
+    return op;
+}
+
+void DisplayList::clear() {
+    count_ = 0;
+    memset(page_count_, 0, sizeof(page_count_));
+}
+
+bool DisplayList::add(const DrawOp& op) {
+    if (op.bounds.empty()) {
+        return true;
+    }
+    if (count_ == MAX_DRAW_OPS) {
+        Serial.println(F("Display list full, op dropped"));
+        return false;
+    }
+
+    ops_[count_++] = op;
+    return true;
+}
+
+void DisplayList::bucket() {
+    memset(page_count_, 0, sizeof(page_count_));
+
+    for (int i = 0; i < count_; ++i) {
+        const ScreenRect& bounds = ops_[i].bounds;
+        const int first_page = bounds.y0 / PAGE_HEIGHT;
+        const int last_page = (bounds.y1 - 1) / PAGE_HEIGHT;
+
+        for (int page = first_page; page <= last_page; ++page) {
+            page_ops_[page][page_count_[page]++] = (uint8_t)i;
+        }
+    }
+}
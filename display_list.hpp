@@ -0,0 +1,105 @@
+#ifndef RWCLOCK_DISPLAY_LIST_HPP_
+#define RWCLOCK_DISPLAY_LIST_HPP_
+
+#include <cstdint>
+
+#include "compositor.hpp"
+#include "display.hpp"
+#include "raster_ops.hpp"
+#include "text_renderer.hpp"
+
+constexpr int MAX_DRAW_OPS = 96;    // 72 circles of the clock, the rest of the scene
+
+// Pixels [x0, x1) x [y0, y1) of the screen
+struct ScreenRect {
+    int16_t x0;
+    int16_t y0;
+    int16_t x1;
+    int16_t y1;
+
+    bool empty() const { return x0 >= x1 || y0 >= y1; }
+};
+
+enum class DrawOpType : uint8_t {
+    Fill,       // rows of the bounds with a pattern
+    Disc,       // a filled circle
+    Ring,       // a circle outline
+    Picture,    // a compositor layer
+    Text,
+};
+
+struct FillOp {
+    RowPattern pattern;     // aligned to the screen
+    BlitMode mode;
+    uint8_t row_step;       // only the rows with y % row_step == row_phase
+    uint8_t row_phase;
+};
+
+struct CircleOp {
+    int16_t x0;
+    int16_t y0;
+    int16_t r;
+    unsigned short color;
+};
+
+// A Layer, which can't be in the union with its default member initializers
+struct PictureOp {
+    BitmapFile* image;
+    BitmapFile* mask;
+    int16_t x0;
+    int16_t y0;
+    bool invert;
+
+    Layer layer() const { return Layer{ image, mask, x0, y0, invert }; }
+};
+
+struct TextOp {
+    const TextLayout* layout;
+    int16_t x;              // the cursor, like for drawText()
+    int16_t y;
+    unsigned short color;
+};
+
+// One drawing call of the scene, with the pixels it may touch
+struct DrawOp {
+    DrawOpType type;
+    ScreenRect bounds;      // clipped to the screen
+    union {
+        CircleOp circle{};  // Disc and Ring
+        FillOp fill;
+        PictureOp picture;
+        TextOp text;
+    };
+};
+
+DrawOp fillOp(ScreenRect rect, const RowPattern& pattern, BlitMode mode,
+              uint8_t row_step = 1, uint8_t row_phase = 0);
+DrawOp discOp(int x0, int y0, int r, unsigned short color);
+DrawOp ringOp(int x0, int y0, int r, unsigned short color);
+DrawOp pictureOp(const Layer& layer);
+DrawOp textOp(const TextLayout& layout, int x, int y, unsigned short color);
+
+// The scene of one minute, built once and then replayed for each page.
+// The ops are drawn in the order they were added, later ones on top.
+class DisplayList {
+  public:
+    void clear();
+
+    // Ops outside of the screen are left out, false if the list is full
+    bool add(const DrawOp& op);
+
+    // Sorts the ops into the pages their bounds touch, in order
+    void bucket();
+
+    int size() const { return count_; }
+    int pageSize(int page) const { return page_count_[page]; }
+    const DrawOp& pageOp(int page, int i) const { return ops_[page_ops_[page][i]]; }
+
+  private:
+    DrawOp ops_[MAX_DRAW_OPS];
+    uint8_t count_ = 0;
+    uint8_t page_ops_[PAGE_COUNT][MAX_DRAW_OPS] = {};
+    uint8_t page_count_[PAGE_COUNT] = {};
+};
+
+#endif  // RWCLOCK_DISPLAY_LIST_HPP_
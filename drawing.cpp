@@ -1,180 +1,421 @@
 
 #include "bitmap_selector.hpp"
 #include "clock_coordinates.hpp"
+#include "compositor.hpp"
 #include "display.hpp"
+#include "display_list.hpp"
 #include "drawing.hpp"
 #include "fonts.hpp"
+#include "frame_diff.hpp"
+#include "frame_store.hpp"
+#include "memory_stats.hpp"
 #include "meteo.hpp"
+#include "raster_ops.hpp"
+#include "text_renderer.hpp"
 
-#include <optional>
+static RowPattern colorPattern(unsigned short color) {
+  return solidPattern(color == GxEPD_WHITE);
+}
+
+// Pixels x % 3 == 0 white, the rest black, repeating every 96 pixels
+constexpr RowPattern everyThirdPixelPattern() {
+  RowPattern pattern{ {}, 3 };
+  for (int x = 0; x < 96; x += 3) {
+    pattern.words[x / 32] |= 0x80000000u >> (x % 32);
+  }
+  return pattern;
+}
+
+// Fills pixels [x_begin, x_end) of a screen row, clipped to the screen and the current page.
+// Patterns are aligned to the screen, not to the span.
+static void fillSpan(int current_page, int y, int x_begin, int x_end,
+                     const RowPattern& pattern, BlitMode mode = BlitMode::Copy) {
+  const int page_y = y - current_page * PAGE_HEIGHT;
+  if (page_y < 0 || page_y >= PAGE_HEIGHT) {
+    return;
+  }
 
-static void fillCircle(short x0, short y0, short r, unsigned short color) {
+  x_begin = std::max(x_begin, 0);
+  x_end = std::min(x_end, (int)WIDTH);
+  fillRow(getDisplayBuffer() + WIDTH / 8 * page_y, x_begin, x_end - x_begin, pattern, mode);
+}
+
+static void fillCircle(int current_page, short x0, short y0, short r, unsigned short color) {
     if (color == GxEPD_WHITE || color == GxEPD_BLACK) {
-        display.fillCircle(x0, y0, r, color);
+        // The same pixels as Adafruit_GFX::fillCircle(), which draws columns.
+        // The circle is symmetric along the diagonal, so its columns are rows.
+        const RowPattern pattern = colorPattern(color);
+        auto fillRows = [&](short dy, short half_width) {
+            fillSpan(current_page, y0 - dy, x0 - half_width, x0 + half_width + 1, pattern);
+            fillSpan(current_page, y0 + dy, x0 - half_width, x0 + half_width + 1, pattern);
+        };
+
+        fillSpan(current_page, y0, x0 - r, x0 + r + 1, pattern);
+
+        short f = 1 - r;
+        short ddF_x = 1;
+        short ddF_y = -2 * r;
+        short x = 0;
+        short y = r;
+        short px = x;
+        short py = y;
+
+        while (x < y) {
+            if (f >= 0) {
+                y--;
+                ddF_y += 2;
+                f += ddF_y;
+            }
+            x++;
+            ddF_x += 2;
+            f += ddF_x;
+
+            if (x < y + 1) {
+                fillRows(x, y);
+            }
+            if (y != py) {
+                fillRows(py, px);
+                py = y;
+            }
+            px = x;
+        }
     }
     else if (color == GxEPD_DARKGREY) {
-        // shade, filling half of pixels black, half white
-        for (short y = y0 - r; y < y0 + r; ++y) {
-            for (short x = x0 - r; x < x0 + r; ++x) {
-                short dx = x - x0;
-                short dy = y - y0;
-                if (dx * dx + dy * dy >= r * r) continue;
-                display.drawPixel(x, y, (x % 3 + y % 3) ? GxEPD_BLACK : GxEPD_WHITE);
+        // shade, leaving every third pixel of every third row white
+        static constexpr RowPattern dots = everyThirdPixelPattern();
+        static constexpr RowPattern black = solidPattern(false);
+
+        // pixels with dx * dx + dy * dy < r * r, clipped to x < x0 + r
+        short half_width = r - 1;
+        for (short dy = 0; dy < r; ++dy) {
+            while (half_width * half_width + dy * dy >= r * r) --half_width;
+
+            for (short y : { (short)(y0 - dy), (short)(y0 + dy) }) {
+                fillSpan(current_page, y, x0 - half_width, x0 + half_width + 1,
+                         y % 3 == 0 ? dots : black);
+                if (dy == 0) break;
             }
         }
     }
 }
 
-static void drawClock(const struct tm& now, const Palette& palette, short x0, short y0) {
+// The same pixels as Adafruit_GFX::drawCircle(), merged into horizontal runs
+static void drawCircle(int current_page, short x0, short y0, short r, unsigned short color) {
+  const RowPattern pattern = colorPattern(color);
+
+  auto fillRun = [&](short x_from, short x_to, short dy) {
+    for (short y : { (short)(y0 - dy), (short)(y0 + dy) }) {
+      fillSpan(current_page, y, x0 + x_from, x0 + x_to + 1, pattern);
+      fillSpan(current_page, y, x0 - x_to, x0 - x_from + 1, pattern);
+    }
+  };
+
+  auto drawPixels = [&](short dx, short dy) {
+    for (short y : { (short)(y0 - dy), (short)(y0 + dy) }) {
+      fillSpan(current_page, y, x0 + dx, x0 + dx + 1, pattern);
+      fillSpan(current_page, y, x0 - dx, x0 - dx + 1, pattern);
+    }
+  };
+
+  short f = 1 - r;
+  short ddF_x = 1;
+  short ddF_y = -2 * r;
+  short x = 0;
+  short y = r;
+  short run_begin = 0;  // the flat octants, rows y0 +- y
+
+  drawPixels(r, 0);
+
+  while (x < y) {
+    if (f >= 0) {
+      fillRun(run_begin, x, y);
+      run_begin = x + 1;
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+
+    // the steep octants, one pixel per row
+    drawPixels(y, x);
+  }
+
+  fillRun(run_begin, x, y);
+}
+
+static void addClock(DisplayList& list, const struct tm& now, const Palette& palette,
+                     short x0, short y0) {
   const int now_h = now.tm_hour % 12;
   const int now_m = now.tm_min;
 
   for (int h = now_h; h < 12; ++h) {
     const auto [hx, hy] = hour_circles_positions[h];
-    fillCircle(hx + x0, hy + y0, HOURS_CIRCLE_OUTER_R, palette.detail_color);
+    list.add(discOp(hx + x0, hy + y0, HOURS_CIRCLE_OUTER_R, palette.detail_color));
   }
 
   {
     const auto [now_hx, now_hy] = hour_circles_positions[now_h];
     // fill inner proportionally to how much of this hour has already passed
     const short now_hr = HOURS_CIRCLE_INNER_R * now_m / 60;  // < linear in r, not area
-    fillCircle(now_hx + x0, now_hy + y0, now_hr, palette.background_color);
+    list.add(discOp(now_hx + x0, now_hy + y0, now_hr, palette.background_color));
   }
 
   for (int m = now_m; m < 60; ++m) {
     const auto [mx, my] = minutes_circles_positions[m];
-    fillCircle(mx + x0, my + y0, MINUTES_CIRCLE_OUTER_R, palette.detail_color);
+    list.add(discOp(mx + x0, my + y0, MINUTES_CIRCLE_OUTER_R, palette.detail_color));
   }
 
   {
     const auto [now_mx, now_my] = minutes_circles_positions[now_m];
-    fillCircle(now_mx + x0, now_my + y0, MINUTES_CIRCLE_INNER_R, palette.background_color);
+    list.add(discOp(now_mx + x0, now_my + y0, MINUTES_CIRCLE_INNER_R, palette.background_color));
   }
 
   const short ring_inner_r = CLOCK_R_MINUTES - MINUTES_CIRCLE_OUTER_R - 1;
   const short ring_outer_r = CLOCK_R_MINUTES + MINUTES_CIRCLE_OUTER_R + 1;
 
-  display.drawCircle(x0, y0, ring_inner_r, palette.front_color);
-  display.drawCircle(x0, y0, ring_outer_r, palette.front_color);
+  list.add(ringOp(x0, y0, ring_inner_r, palette.front_color));
+  list.add(ringOp(x0, y0, ring_outer_r, palette.front_color));
 }
 
-static void drawBitmapFromFile(BitmapFile& bmp, int current_page,
-                               int x_center, int y_center,
-                               Palette p, bool invert = false) {
-  unsigned char* display_buffer = getDisplayBuffer();
+static Layer centeredLayer(BitmapFile& bmp, int x_center, int y_center, bool invert = false) {
+  return Layer{ .image = &bmp,
+                .x0 = x_center - (int)bmp.width / 2,
+                .y0 = y_center - (int)bmp.height / 2,
+                .invert = invert };
+}
 
-  const int picture_x0 = x_center - bmp.width / 2;
-  const int picture_y0 = y_center - bmp.height / 2;
+static void addWeather(DisplayList& list, Palette palette) {
+    if (config.skip_weather_data) {
+        return;
+    }
 
-  const int begin_draw_row = current_page * PAGE_HEIGHT;
-  const int end_draw_row   = (current_page + 1) * PAGE_HEIGHT;
+    char temperature_text[8];
+    snprintf(temperature_text, 8, "%d/:", meteo_data.temp_now);
 
-  const int begin_bitmap_row = picture_y0;
-  const int end_bitmap_row   = picture_y0 + bmp.height;
+    // the layouts are memoized, the texts change at most with the weather updates
+    const TextLayout& temperature = layoutText(&rodondo_digits_64pt, temperature_text);
+    list.add(textOp(temperature,
+                    weather_x0() - temperature.w / 2,
+                    weather_y0() + temperature.h + MAX_WEATHER_PICTURE_HEIGHT / 2,
+                    palette.front_color));
+
+    const TextLayout& location = layoutText(&rodondo_20pt, meteo_data.location);
+    list.add(textOp(location,
+                    weather_x0() - location.w / 2,
+                    weather_y0() - location.h / 2 - MAX_WEATHER_PICTURE_HEIGHT / 2,
+                    palette.front_color));
+}
 
-  const int begin_copy_row = std::max(begin_draw_row, begin_bitmap_row);
-  const int end_copy_row   = std::min(end_draw_row, end_bitmap_row);
+static void addDiffuseWeather(DisplayList& list, Palette palette) {
+  // every fourth row of the weather half, one pixel in four towards the background
+  const bool white = palette.background_color == GxEPD_WHITE;
+  const RowPattern pattern = repeatedBytePattern(white ? 0b00010001 : 0b11101110);
+  const BlitMode mode = white ? BlitMode::Or : BlitMode::And;
 
-  const int begin_copy_row_in_bmp = bmp.height - (end_copy_row - picture_y0);
+  list.add(fillOp(ScreenRect{ HEIGHT, 0, WIDTH, HEIGHT }, pattern, mode, 4, 3));
+}
 
-  bmp.f.seek(begin_copy_row_in_bmp * bmp.width / 8 + bmp.data_offset);
+// The scene is built once per minute, only the ops touching a page are replayed for it
+static void buildDisplayList(DisplayList& list, const struct tm& now, const Palette& palette,
+                             BitmapFile* picture, BitmapFile* weather_icon) {
+  list.clear();
+  list.add(fillOp(ScreenRect{ 0, 0, WIDTH, HEIGHT },
+                  colorPattern(palette.background_color), BlitMode::Copy));
 
-  for (int h = end_copy_row - 1; h >= begin_copy_row; --h) {
-    unsigned char row[MAX_PICTURE_WIDTH / 8];
-    bmp.f.readBytes((char*)row, bmp.width / 8);
-    unsigned char* row_buffer = display_buffer + WIDTH / 8 * (h % PAGE_HEIGHT) + picture_x0 / 8;
+  addClock(list, now, palette, clock_x0(), clock_y0());
 
-    if (p.background_color == GxEPD_WHITE) {
-      for (int i = 0; i < bmp.width / 8; ++i) {
-        row_buffer[i] &= row[i];
-      }
-    } else if (!invert) {
-      for (int i = 0; i < bmp.width / 8; ++i) {
-        row_buffer[i] |= row[i];
-      }
-    } else {
-      for (int i = 0; i < bmp.width / 8; ++i) {
-        row_buffer[i] |= ~row[i];
+  // pictures over the clock, the text of the weather goes on top of them
+  if (picture) {
+    list.add(pictureOp(centeredLayer(*picture, clock_x0(), clock_y0())));
+  }
+  if (weather_icon && !config.skip_weather_data) {
+    list.add(pictureOp(centeredLayer(*weather_icon, weather_x0(), weather_y0(),
+                                     palette.front_color == GxEPD_WHITE)));
+  }
+
+  addWeather(list, palette);
+  addDiffuseWeather(list, palette);
+
+  list.bucket();
+}
+
+static void replayOp(const DrawOp& op, int current_page, const Palette& palette) {
+  switch (op.type) {
+    case DrawOpType::Fill: {
+      const int begin_row = std::max((int)op.bounds.y0, current_page * PAGE_HEIGHT);
+      const int end_row = std::min((int)op.bounds.y1, (current_page + 1) * PAGE_HEIGHT);
+      for (int y = begin_row; y < end_row; ++y) {
+        if (y % op.fill.row_step == op.fill.row_phase) {
+          fillSpan(current_page, y, op.bounds.x0, op.bounds.x1, op.fill.pattern, op.fill.mode);
+        }
       }
+      break;
+    }
+    case DrawOpType::Disc:
+      fillCircle(current_page, op.circle.x0, op.circle.y0, op.circle.r, op.circle.color);
+      break;
+    case DrawOpType::Ring:
+      drawCircle(current_page, op.circle.x0, op.circle.y0, op.circle.r, op.circle.color);
+      break;
+    case DrawOpType::Picture: {
+      const Layer layer = op.picture.layer();
+      compositeLayers(&layer, 1, current_page, palette);
+      break;
     }
+    case DrawOpType::Text:
+      drawText(*op.text.layout, op.text.x, op.text.y, op.text.color, current_page);
+      break;
   }
 }
 
-static void drawWeather(Palette palette, std::optional<BitmapFile>& icon, int x0, int y0, int current_page) {
-    if (config.skip_weather_data) {
-        return;
-    }
+static DisplayList display_list;
 
-    if (icon) {
-       drawBitmapFromFile(*icon, current_page, weather_x0(), weather_y0(),
-                          palette, palette.front_color == GxEPD_WHITE);
-    }
+static void renderPage(int current_page, const Palette& palette) {
+  for (int i = 0; i < display_list.pageSize(current_page); ++i) {
+    replayOp(display_list.pageOp(current_page, i), current_page, palette);
+  }
+}
 
-    display.setFont(&rodondo_digits_64pt);
-    display.setTextColor(palette.front_color);
+// All of the pages through the paged loop of GxEPD2, in the window already set
+static void drawAllPages(const Palette& palette) {
+  frame_hashes.invalidate();
 
-    char temperature_text[8];
-    snprintf(temperature_text, 8, "%d/:", meteo_data.temp_now);
+  int current_page = 0;
+  display.firstPage();
+  do {
+    renderPage(current_page, palette);
+    frame_hashes.update(current_page);
 
-    int16_t x1 = 0, y1 = 0;
-    uint16_t w = 0, h = 0;
-    display.getTextBounds(temperature_text, 0, 0, &x1, &y1, &w, &h);
+    ++current_page;
+    current_page %= PAGE_COUNT;
+  } while (display.nextPage());
+}
 
-    // Serial.printf("Text bounds: %d,%d,%d,%d\n", x1, y1, w, h);
-    display.setCursor(weather_x0() - w / 2, weather_y0() + h + MAX_WEATHER_PICTURE_HEIGHT / 2);
-    display.print(temperature_text);
+static ScreenRect unite(const ScreenRect& a, const ScreenRect& b) {
+  if (a.empty()) return b;
+  if (b.empty()) return a;
+  return ScreenRect{ std::min(a.x0, b.x0), std::min(a.y0, b.y0),
+                     std::max(a.x1, b.x1), std::max(a.y1, b.y1) };
+}
 
-    display.setFont(&rodondo_20pt);
-    display.setCursor(16, 32);
-    display.getTextBounds(meteo_data.location, 0, 0, &x1, &y1, &w, &h);
-    display.setCursor(weather_x0() - w / 2, weather_y0() - h / 2 - MAX_WEATHER_PICTURE_HEIGHT / 2);
-    display.print(meteo_data.location);
+// Writes a part of the page rendered in the display buffer to the panel
+static void writePagePart(const ScreenRect& rect, int current_page, bool again) {
+  const int page_y = rect.y0 - current_page * PAGE_HEIGHT;
+  const int w = rect.x1 - rect.x0;
+  const int h = rect.y1 - rect.y0;
+  if (again) {
+    display.epd2.writeImagePartAgain(getDisplayBuffer(), rect.x0, page_y, WIDTH, PAGE_HEIGHT,
+                                     rect.x0, rect.y0, w, h);
+  } else {
+    display.epd2.writeImagePart(getDisplayBuffer(), rect.x0, page_y, WIDTH, PAGE_HEIGHT,
+                                rect.x0, rect.y0, w, h);
+  }
 }
 
-void diffuseWeather(Palette palette) {
-  unsigned char* display_buffer = getDisplayBuffer();
+// Only the tiles changed since the last frame, as partial windows.
+// Pages without changes aren't sent, nothing is refreshed if none changed.
+static void drawChangedTiles(const Palette& palette) {
+  ScreenRect changed[PAGE_COUNT];
+  ScreenRect refreshed{};
+
+  for (int page = 0; page < PAGE_COUNT; ++page) {
+    renderPage(page, palette);
+    changed[page] = frame_hashes.update(page);
+    if (!changed[page].empty()) {
+      writePagePart(changed[page], page, false);
+      refreshed = unite(refreshed, changed[page]);
+    }
+  }
 
-  if (palette.background_color == GxEPD_WHITE) {
-    for (int y = 0; y < PAGE_HEIGHT; y += 4) {
-      for (int x = HEIGHT / 8; x < WIDTH / 8; ++x) {
-        display_buffer[(y + 3) * WIDTH / 8 + x] |= 0b00010001;
-      }
+  if (refreshed.empty()) {
+    Serial.println(F("Nothing changed, display not refreshed"));
+    return;
+  }
+
+  frame_store.beginFrame();
+
+  Serial.printf_P(PSTR("Refreshing %dx%d at (%d, %d)\n"),
+                  refreshed.x1 - refreshed.x0, refreshed.y1 - refreshed.y0,
+                  refreshed.x0, refreshed.y0);
+  display.epd2.refresh(refreshed.x0, refreshed.y0,
+                       refreshed.x1 - refreshed.x0, refreshed.y1 - refreshed.y0);
+
+  // the partial refresh goes from the previous frame in the controller,
+  // like GxEPD2 does the changed parts are written there too afterwards
+  for (int page = 0; page < PAGE_COUNT; ++page) {
+    if (!changed[page].empty()) {
+      renderPage(page, palette);
+      writePagePart(changed[page], page, true);
     }
-  } else {
-    for (int y = 0; y < PAGE_HEIGHT; y += 4) {
-      for (int x = HEIGHT / 8; x < WIDTH / 8; ++x) {
-        display_buffer[(y + 3) * WIDTH / 8 + x] &= 0b11101110;
+  }
+  frame_store.commitFrame();
+}
+
+// After a reset the controller doesn't know what the panel shows. The tiles
+// whose hashes match the frame kept in the RTC memory are shown already, the
+// others are written to the controller inverted as the previous frame, so the
+// partial refresh that follows drives all of their pixels.
+static void restoreShownFrame(const Palette& palette) {
+  uint8_t* display_buffer = getDisplayBuffer();
+  int unknown_tiles = 0;
+
+  for (int page = 0; page < PAGE_COUNT; ++page) {
+    renderPage(page, palette);
+    frame_hashes.update(page);
+
+    for (int row = 0; row < PAGE_TILE_ROWS; ++row) {
+      for (int column = 0; column < TILE_COLUMNS; ++column) {
+        if (frame_store.tileShown(page * PAGE_TILE_ROWS + row, column)) {
+          continue;
+        }
+        uint8_t* tile = display_buffer + row * TILE_HEIGHT * (WIDTH / 8) + column * (TILE_WIDTH / 8);
+        for (int y = 0; y < TILE_HEIGHT; ++y, tile += WIDTH / 8) {
+          for (int x = 0; x < TILE_WIDTH / 8; ++x) {
+            tile[x] = ~tile[x];
+          }
+        }
+        ++unknown_tiles;
       }
     }
+
+    // the inverted tiles differ from the next frame, they are refreshed
+    frame_hashes.update(page);
+    display.epd2.writeImageAgain(display_buffer, 0, page * PAGE_HEIGHT, WIDTH, PAGE_HEIGHT);
   }
+
+  Serial.printf_P(PSTR("Last frame restored, %d tiles unknown\n"), unknown_tiles);
 }
 
-void drawDisplay(const struct tm& now) {
+void drawDisplay(const struct tm& now, bool full_refresh) {
+  MemoryProbe probe(MemoryUser::Drawing);
   Serial.printf_P(PSTR("Drawing display for %02d:%02d\n"), now.tm_hour, now.tm_min);
 
-  std::optional<BitmapFile> picture = getBackgroundImage(now);
-  std::optional<BitmapFile> weather_icon = getWeatherIcon();
+  // Both files are kept open by their selectors between the minutes
+  BitmapFile* picture = getBackgroundImage(now);
+  BitmapFile* weather_icon = getWeatherIcon();
 
   const Palette palette = getCurrentDisplayMode(now) == DisplayMode::Dark
     ? DARK_PALETTE
     : LIGHT_PALETTE;
 
-  int current_page = 0;
-  display.firstPage();
-  do {
-    display.fillScreen(palette.background_color);
-    drawClock(now, palette, clock_x0(), clock_y0());
+  buildDisplayList(display_list, now, palette, picture, weather_icon);
 
-    if (picture) {
-        drawBitmapFromFile(*picture, current_page, clock_x0(), clock_y0(), palette);
-    }
-
-    drawWeather(palette, weather_icon, weather_x0(), weather_y0(), current_page);
-    diffuseWeather(palette);
+  // after a reset, the frame kept in the RTC memory is what the panel shows
+  if (!full_refresh && !frame_hashes.valid() && frame_store.loaded()) {
+    restoreShownFrame(palette);
+  }
 
-    ++current_page;
-    current_page %= PAGE_COUNT;
-  } while (display.nextPage());
+  if (full_refresh || !frame_hashes.valid()) {
+    // nothing to diff against, the controller might not know the panel either
+    frame_store.beginFrame();
+    display.setFullWindow();
+    drawAllPages(palette);
+    frame_store.commitFrame();
+  } else {
+    drawChangedTiles(palette);
+  }
 
   display.powerOff();
 }
@@ -3,6 +3,7 @@
 
 #include <ctime>
 
-void drawDisplay(const struct tm& now);
+// Without a full refresh, only the tiles changed since the last frame are sent
+void drawDisplay(const struct tm& now, bool full_refresh);
 
 #endif  // RWCLOCK_DRAWING_HPP_
@@ -0,0 +1,431 @@
+// Generated by tools/font_subset, do not edit
+#include <sys/pgmspace.h>
+#include "fonts.hpp"
+
+// Rodondo font
+// Created by Olly Wood @olllywood
+
+const uint8_t rodondo_20pt_bitmaps[] PROGMEM = {
+  0x00, 0x37, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xFF,
+  0xF6, 0xF7, 0xFB, 0xFD, 0xFC, 0xEC, 0x60, 0x00, 0x0A, 0x05, 0x04, 0x05,
+  0x0A, 0x05, 0x04, 0x04, 0x0B, 0x04, 0x04, 0x05, 0x0A, 0x05, 0x04, 0x05,
+  0x0A, 0x04, 0x05, 0x04, 0x0A, 0x05, 0x04, 0x05, 0x0A, 0x04, 0x05, 0x04,
+  0x03, 0x60, 0x06, 0x04, 0x05, 0x04, 0x0A, 0x05, 0x04, 0x05, 0x0A, 0x04,
+  0x04, 0x05, 0x06, 0x60, 0x02, 0x05, 0x04, 0x05, 0x0A, 0x04, 0x05, 0x04,
+  0x0B, 0x04, 0x04, 0x05, 0x0A, 0x05, 0x04, 0x04, 0x0B, 0x04, 0x05, 0x04,
+  0x0A, 0x05, 0x04, 0x05, 0x0A, 0x01, 0x00, 0x18, 0x01, 0xC0, 0x1F, 0xE3,
+  0xFF, 0x3F, 0xF1, 0xFE, 0x1F, 0xE0, 0xF7, 0x07, 0xB8, 0x3D, 0xC1, 0xFE,
+  0x07, 0xF0, 0x3F, 0xE0, 0x7F, 0x80, 0xFE, 0x07, 0xF0, 0x3F, 0xC1, 0xDE,
+  0x0E, 0xF0, 0x77, 0x83, 0xFC, 0x1F, 0xDF, 0xFE, 0x7F, 0xE1, 0xFE, 0x07,
+  0xC0, 0x0E, 0x00, 0x70, 0x00, 0x1F, 0x00, 0x78, 0x3F, 0x80, 0xF0, 0x7F,
+  0xC1, 0xF0, 0xF1, 0xE1, 0xE0, 0xE0, 0xE3, 0xC0, 0xE0, 0xE3, 0xC0, 0xE0,
+  0xE7, 0x80, 0xF1, 0xE7, 0x80, 0x7F, 0xCF, 0x00, 0x3F, 0x9E, 0x00, 0x1F,
+  0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x79, 0xF8, 0x00,
+  0xF3, 0xFC, 0x00, 0xF7, 0xFE, 0x01, 0xEF, 0x0F, 0x01, 0xCE, 0x07, 0x03,
+  0xCE, 0x07, 0x03, 0x8E, 0x07, 0x07, 0x8F, 0x0F, 0x0F, 0x07, 0xFE, 0x0E,
+  0x03, 0xFC, 0x1E, 0x01, 0xF8, 0x07, 0xC0, 0x01, 0xFC, 0x00, 0x7F, 0xC0,
+  0x1F, 0xFC, 0x03, 0xE7, 0x80, 0x78, 0xF0, 0x0F, 0x1E, 0x01, 0xE7, 0xC0,
+  0x1F, 0xF0, 0x03, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x07, 0xFC, 0x00,
+  0xF3, 0xC0, 0x3C, 0x3C, 0x07, 0x87, 0xDF, 0xF0, 0x7F, 0xDE, 0x07, 0xF3,
+  0xE0, 0x7C, 0x3E, 0x1F, 0x87, 0xFF, 0xF8, 0x7F, 0xFF, 0x07, 0xFD, 0xF0,
+  0x3E, 0x1F, 0xFF, 0xFE, 0xEC, 0x3C, 0xF7, 0x9E, 0x79, 0xE7, 0xBC, 0xF3,
+  0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xC7, 0x9E, 0x79,
+  0xE7, 0x8F, 0x3C, 0xF3, 0xC7, 0x9E, 0x79, 0xE7, 0x8F, 0x3C, 0xF3, 0xCF,
+  0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3D, 0xF7, 0x9E, 0x79, 0xE7, 0xBC,
+  0xF0, 0x00, 0x00, 0x60, 0x0E, 0x0C, 0xE0, 0xFF, 0x87, 0xFE, 0x7F, 0xE3,
+  0xF0, 0x3F, 0x07, 0xF0, 0xF3, 0x00, 0x10, 0x00, 0x00, 0x05, 0x04, 0x0B,
+  0x04, 0x0B, 0x04, 0x0B, 0x04, 0x0B, 0x04, 0x06, 0x3C, 0x05, 0x04, 0x0B,
+  0x04, 0x0B, 0x04, 0x0B, 0x04, 0x0B, 0x04, 0x06, 0xFF, 0xFE, 0xEC, 0x1F,
+  0xE7, 0xFD, 0xFF, 0x7F, 0x80, 0x77, 0xFF, 0xF7, 0x00, 0x0F, 0x04, 0x0E,
+  0x05, 0x0E, 0x04, 0x0E, 0x05, 0x0E, 0x04, 0x0E, 0x05, 0x0E, 0x04, 0x0E,
+  0x05, 0x0E, 0x04, 0x0E, 0x05, 0x0E, 0x04, 0x0E, 0x05, 0x0E, 0x04, 0x0E,
+  0x05, 0x0E, 0x04, 0x0E, 0x05, 0x0E, 0x04, 0x0E, 0x05, 0x0E, 0x04, 0x0E,
+  0x05, 0x0E, 0x04, 0x0E, 0x05, 0x0E, 0x04, 0x0E, 0x05, 0x0E, 0x04, 0x0E,
+  0x05, 0x0E, 0x04, 0x0E, 0x05, 0x0E, 0x04, 0x0E, 0x05, 0x0E, 0x03, 0xE0,
+  0x07, 0xFC, 0x07, 0xFF, 0x07, 0xFF, 0xC3, 0xE3, 0xE3, 0xE0, 0xF9, 0xE0,
+  0x3C, 0xF0, 0x1E, 0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xFF,
+  0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0x78, 0x0F, 0x3C, 0x07,
+  0x9F, 0x07, 0xC7, 0xC7, 0xC3, 0xFF, 0xE0, 0xFF, 0xE0, 0x3F, 0xE0, 0x07,
+  0xC0, 0x00, 0x54, 0x01, 0x03, 0x02, 0x02, 0x03, 0x01, 0x07, 0xC0, 0x3F,
+  0xE0, 0xFF, 0xE1, 0xFF, 0xC0, 0xC7, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E,
+  0x00, 0x7C, 0x00, 0xF0, 0x03, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x7C, 0x00,
+  0xF0, 0x03, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x7C, 0x00, 0xF0, 0x03, 0xFF,
+  0x07, 0xFF, 0x1F, 0xFF, 0x7F, 0xFF, 0x07, 0xC0, 0x7F, 0xC3, 0xFF, 0x9F,
+  0xFE, 0x38, 0x7C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x7C, 0x0F, 0xE0,
+  0x3F, 0x00, 0xFC, 0x03, 0xF8, 0x01, 0xE0, 0x07, 0xC0, 0x0F, 0x10, 0x3F,
+  0xC0, 0xFF, 0x07, 0xFE, 0x3E, 0x7F, 0xF8, 0xFF, 0xC1, 0xFE, 0x03, 0xE0,
+  0x21, 0x01, 0x12, 0x01, 0x11, 0x02, 0x10, 0x03, 0x0F, 0x04, 0x0F, 0x04,
+  0x0E, 0x05, 0x0D, 0x06, 0x0C, 0x07, 0x0C, 0x07, 0x0B, 0x08, 0x0A, 0x09,
+  0x0A, 0x04, 0x01, 0x04, 0x09, 0x05, 0x01, 0x04, 0x08, 0x05, 0x02, 0x04,
+  0x07, 0x05, 0x03, 0x04, 0x07, 0x0D, 0x05, 0x10, 0x02, 0x12, 0x01, 0x12,
+  0x0B, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x0F, 0x04, 0x04, 0x07, 0xFE, 0x0F,
+  0xFC, 0x3F, 0xF0, 0x7F, 0x80, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00,
+  0x3C, 0x00, 0x7F, 0x80, 0xFF, 0xC3, 0xFF, 0xC7, 0xFF, 0xCF, 0x8F, 0x80,
+  0x0F, 0x80, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F, 0xE0, 0xFB, 0xE3, 0xE7, 0xFF,
+  0xC7, 0xFF, 0x07, 0xFC, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00,
+  0x0E, 0x00, 0x1C, 0x00, 0x78, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x80, 0x1E,
+  0x00, 0x7F, 0x81, 0xFF, 0x83, 0xFF, 0x8F, 0xFF, 0x9F, 0x1F, 0x7C, 0x1F,
+  0xF0, 0x1F, 0xE0, 0x3F, 0xC0, 0x7F, 0xC1, 0xF7, 0xC7, 0xCF, 0xFF, 0x8F,
+  0xFE, 0x0F, 0xF8, 0x07, 0xC0, 0xFF, 0xFE, 0xFF, 0xFC, 0xFF, 0xF0, 0xFF,
+  0xE0, 0x07, 0x80, 0x0F, 0x00, 0x3C, 0x00, 0x78, 0x01, 0xF0, 0x03, 0xC0,
+  0x07, 0x80, 0x1E, 0x00, 0x3C, 0x00, 0xF0, 0x01, 0xE0, 0x07, 0x80, 0x0F,
+  0x00, 0x3C, 0x00, 0x78, 0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x80, 0x1E, 0x00,
+  0x7C, 0x00, 0x07, 0xC0, 0x3F, 0xE0, 0xFF, 0xE1, 0xFF, 0xC7, 0xC7, 0xCF,
+  0x07, 0x9E, 0x0F, 0x3C, 0x1E, 0x7C, 0x7C, 0x7F, 0xF0, 0x7F, 0xC1, 0xFF,
+  0xC7, 0xFF, 0xCF, 0x8F, 0xBE, 0x0F, 0xF8, 0x0F, 0xF0, 0x1F, 0xE0, 0x3F,
+  0xE0, 0xFB, 0xE3, 0xE7, 0xFF, 0xC7, 0xFF, 0x07, 0xFC, 0x03, 0xE0, 0x07,
+  0xC0, 0x3F, 0xE0, 0xFF, 0xE3, 0xFF, 0xE7, 0xC7, 0xDF, 0x07, 0xFC, 0x07,
+  0xF8, 0x0F, 0xF0, 0x1F, 0xF0, 0x7D, 0xF1, 0xF3, 0xFF, 0xE3, 0xFF, 0x83,
+  0xFF, 0x03, 0xFC, 0x00, 0xF0, 0x03, 0xE0, 0x0F, 0x80, 0x1E, 0x00, 0x7C,
+  0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x80, 0x1C, 0x00, 0x00, 0x00, 0x77, 0xFF,
+  0xF7, 0x00, 0x0E, 0xFF, 0xFE, 0xE0, 0x77, 0xFF, 0xF7, 0x00, 0x00, 0xF7,
+  0xBD, 0xCC, 0x40, 0x00, 0x20, 0x0C, 0x07, 0x83, 0xF0, 0xFE, 0x7F, 0x1F,
+  0xC7, 0xE0, 0xF8, 0x1C, 0x03, 0xE0, 0x7F, 0x07, 0xF0, 0x3F, 0x83, 0xF8,
+  0x1F, 0x01, 0xE0, 0x0C, 0x00, 0x00, 0x00, 0x38, 0x2A, 0x38, 0x80, 0x1C,
+  0x03, 0xC0, 0x7E, 0x0F, 0xE0, 0x7F, 0x07, 0xF0, 0x3F, 0x01, 0xE0, 0x3C,
+  0x0F, 0x87, 0xF1, 0xFC, 0xFE, 0x3F, 0x87, 0xC0, 0xE0, 0x18, 0x00, 0x00,
+  0x00, 0x07, 0xE0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7F, 0xFE, 0x7C, 0x3E, 0xF8,
+  0x1F, 0xF0, 0x0F, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1F, 0x00,
+  0x3E, 0x00, 0xFE, 0x01, 0xFC, 0x01, 0xF0, 0x03, 0xE0, 0x03, 0xC0, 0x03,
+  0xC0, 0x00, 0x00, 0x01, 0xC0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x01,
+  0xC0, 0x00, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0xFF, 0xFF,
+  0x83, 0xF8, 0x3F, 0x07, 0xC0, 0x1F, 0x1E, 0x1F, 0x0F, 0x38, 0x7F, 0x5E,
+  0xF1, 0xFF, 0x9D, 0xC7, 0xFF, 0x1F, 0x8F, 0x1E, 0x3F, 0x1C, 0x1C, 0x7E,
+  0x38, 0x38, 0xFC, 0x78, 0xF1, 0xF8, 0xFF, 0xFF, 0xF8, 0xFF, 0xFE, 0x70,
+  0xFF, 0xFC, 0xF0, 0xF8, 0xE0, 0xF8, 0x00, 0x00, 0xFC, 0x0C, 0x01, 0xFF,
+  0xFC, 0x01, 0xFF, 0xF8, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x60, 0x00, 0x06, 0x00, 0x00, 0x70, 0x00, 0x0F,
+  0x00, 0x00, 0xF8, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x3F, 0xC0, 0x03,
+  0xFC, 0x00, 0x3D, 0xE0, 0x07, 0x9E, 0x00, 0x78, 0xE0, 0x0F, 0x0F, 0x00,
+  0xF0, 0xF0, 0x0F, 0xFF, 0x81, 0xFF, 0xF8, 0x1F, 0xFF, 0x83, 0xFF, 0xFC,
+  0x3C, 0x03, 0xC3, 0xC0, 0x1E, 0x78, 0x01, 0xE7, 0x00, 0x1E, 0xE0, 0x00,
+  0xF0, 0xFF, 0x83, 0xFF, 0x8F, 0xFF, 0x3F, 0xFC, 0xF0, 0xFB, 0xC1, 0xEF,
+  0x07, 0xBC, 0x1E, 0xF0, 0xFB, 0xFF, 0xCF, 0xFE, 0x3F, 0xFC, 0xFF, 0xFB,
+  0xE3, 0xEF, 0x07, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF, 0x07, 0xFC, 0x3E,
+  0xFF, 0xFB, 0xFF, 0xCF, 0xFE, 0x3F, 0xE0, 0x00, 0xFE, 0x03, 0xFF, 0x07,
+  0xFF, 0x1F, 0xFF, 0x1F, 0x81, 0x3E, 0x00, 0x7C, 0x00, 0x78, 0x00, 0xF8,
+  0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+  0x00, 0xF8, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x81, 0x1F,
+  0xFF, 0x07, 0xFF, 0x03, 0xFF, 0x00, 0xFE, 0x7F, 0x80, 0x7F, 0xF0, 0x3F,
+  0xFC, 0x1F, 0xFF, 0x8F, 0x0F, 0xC7, 0x81, 0xF3, 0xC0, 0x7D, 0xE0, 0x1E,
+  0xF0, 0x0F, 0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x80,
+  0x3F, 0xC0, 0x1F, 0xE0, 0x1F, 0xF0, 0x0F, 0x78, 0x0F, 0xBC, 0x0F, 0x9E,
+  0x1F, 0x8F, 0xFF, 0xC7, 0xFF, 0x83, 0xFF, 0x81, 0xFF, 0x00, 0xFF, 0xEF,
+  0xFE, 0xFF, 0xEF, 0xFE, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
+  0xFC, 0xFF, 0xCF, 0xFC, 0xFF, 0xCF, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
+  0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x8F, 0xFC, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1F, 0xF3,
+  0xFE, 0x7F, 0xCF, 0xF9, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0,
+  0x78, 0x0F, 0x00, 0xE0, 0x1C, 0x01, 0x80, 0x00, 0x00, 0x00, 0x7F, 0x00,
+  0x3F, 0xF0, 0x07, 0xFF, 0x00, 0xFF, 0xF0, 0x1F, 0x81, 0x03, 0xE0, 0x00,
+  0x7C, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x0F, 0x07, 0xC0, 0xF0, 0x7F,
+  0x8F, 0x03, 0xFC, 0xF0, 0x0F, 0xEF, 0x00, 0x3E, 0xF0, 0x01, 0xFF, 0x80,
+  0x0F, 0x78, 0x00, 0xF7, 0xC0, 0x0F, 0x3E, 0x01, 0xF1, 0xF8, 0x3E, 0x1F,
+  0xFF, 0xE0, 0x7F, 0xFC, 0x03, 0xFF, 0x80, 0x0F, 0xE0, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0,
+  0x0F, 0xF0, 0x0F, 0x70, 0x0F, 0x70, 0x0F, 0x30, 0x0F, 0x03, 0x01, 0x01,
+  0x03, 0x01, 0x57, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F,
+  0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1,
+  0xE1, 0xF1, 0xF7, 0xFB, 0xF9, 0xF8, 0xF0, 0x00, 0xF0, 0x7C, 0xF0, 0xF8,
+  0xF0, 0xF0, 0xF1, 0xF0, 0xF3, 0xE0, 0xF7, 0xC0, 0xFF, 0x80, 0xFF, 0x00,
+  0xFF, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFE, 0x00, 0xFF, 0x00,
+  0xFF, 0x80, 0xF7, 0xC0, 0xF3, 0xC0, 0xF3, 0xE0, 0xF1, 0xF0, 0xF0, 0xF8,
+  0xF0, 0x7C, 0x70, 0x3C, 0x70, 0x3E, 0x30, 0x1F, 0x00, 0x06, 0x01, 0xC0,
+  0x38, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78,
+  0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F,
+  0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0x00, 0x20, 0x01, 0x00,
+  0x10, 0x00, 0xC0, 0x08, 0x00, 0x60, 0x0E, 0x00, 0x70, 0x07, 0x00, 0x3C,
+  0x07, 0x80, 0x1E, 0x03, 0xC0, 0x0F, 0x81, 0xF0, 0x0F, 0xC1, 0xF8, 0x07,
+  0xE0, 0xFC, 0x03, 0xF8, 0xFE, 0x01, 0xFC, 0x7F, 0x81, 0xEF, 0x7B, 0xC0,
+  0xF7, 0xBD, 0xE0, 0x79, 0xFE, 0xF0, 0x38, 0xFE, 0x3C, 0x3C, 0x7F, 0x1E,
+  0x1E, 0x1F, 0x0F, 0x0F, 0x0F, 0x83, 0x8F, 0x03, 0xC1, 0xE7, 0x81, 0xC0,
+  0xF3, 0xC0, 0xE0, 0x79, 0xC0, 0x20, 0x1D, 0xC0, 0x10, 0x0F, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x01, 0xC0, 0x01, 0xF0, 0x00, 0xFC, 0x00, 0xFF, 0x00,
+  0x7F, 0xC0, 0x3F, 0xF0, 0x1F, 0xFC, 0x0F, 0xFE, 0x07, 0xFF, 0x83, 0xFD,
+  0xE1, 0xFE, 0x78, 0xFF, 0x3E, 0x7F, 0x8F, 0xBF, 0xC3, 0xFF, 0xE0, 0xFF,
+  0xF0, 0x3F, 0xF8, 0x0F, 0xFC, 0x03, 0xFE, 0x01, 0xFF, 0x00, 0x7F, 0x80,
+  0x1F, 0xC0, 0x07, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x09, 0x07, 0x0E, 0x0C,
+  0x0B, 0x0E, 0x09, 0x10, 0x07, 0x06, 0x06, 0x06, 0x05, 0x05, 0x0A, 0x05,
+  0x03, 0x05, 0x0C, 0x05, 0x02, 0x04, 0x0E, 0x04, 0x01, 0x05, 0x0E, 0x04,
+  0x01, 0x04, 0x10, 0x08, 0x10, 0x08, 0x10, 0x08, 0x10, 0x08, 0x10, 0x08,
+  0x10, 0x04, 0x01, 0x04, 0x0E, 0x04, 0x02, 0x04, 0x0E, 0x04, 0x02, 0x05,
+  0x0C, 0x05, 0x03, 0x05, 0x0A, 0x05, 0x05, 0x06, 0x06, 0x06, 0x07, 0x10,
+  0x09, 0x0E, 0x0B, 0x0C, 0x0E, 0x08, 0x08, 0xFF, 0x83, 0xFF, 0x8F, 0xFF,
+  0x3F, 0xFE, 0xF0, 0xFB, 0xC1, 0xFF, 0x03, 0xFC, 0x0F, 0xF0, 0x3F, 0xC1,
+  0xFF, 0x8F, 0xBF, 0xFE, 0xFF, 0xF3, 0xFF, 0x8F, 0xF8, 0x3C, 0x00, 0xF0,
+  0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x01, 0xC0, 0x07, 0x00, 0x0C,
+  0x00, 0x09, 0x07, 0x0E, 0x0C, 0x0B, 0x0E, 0x08, 0x12, 0x06, 0x06, 0x06,
+  0x06, 0x05, 0x05, 0x0A, 0x05, 0x03, 0x05, 0x0C, 0x05, 0x02, 0x04, 0x0E,
+  0x04, 0x02, 0x04, 0x0E, 0x04, 0x01, 0x04, 0x10, 0x08, 0x10, 0x08, 0x10,
+  0x08, 0x10, 0x08, 0x10, 0x08, 0x10, 0x09, 0x0E, 0x04, 0x02, 0x04, 0x0E,
+  0x04, 0x02, 0x05, 0x0C, 0x04, 0x04, 0x05, 0x0A, 0x05, 0x05, 0x06, 0x06,
+  0x06, 0x06, 0x11, 0x09, 0x11, 0x08, 0x11, 0x09, 0x10, 0xFF, 0x81, 0xFF,
+  0xC3, 0xFF, 0xC7, 0xFF, 0xCF, 0x0F, 0x9E, 0x0F, 0xBC, 0x0F, 0x78, 0x1E,
+  0xF0, 0x3D, 0xE0, 0x7B, 0xC1, 0xE7, 0xFF, 0xCF, 0xFF, 0x1F, 0xFC, 0x3F,
+  0xE0, 0x7F, 0x80, 0xFF, 0x81, 0xEF, 0x83, 0xCF, 0x07, 0x9F, 0x0F, 0x1F,
+  0x0E, 0x1F, 0x1C, 0x1F, 0x18, 0x3E, 0x0F, 0xF1, 0xFF, 0x9F, 0xF8, 0xFF,
+  0x0F, 0x80, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF8, 0x03, 0xF8, 0x1F, 0xF0,
+  0x3F, 0xC0, 0x7F, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0,
+  0x3E, 0x03, 0xEF, 0xFF, 0x3F, 0xF0, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07,
+  0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01,
+  0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x0E, 0x00,
+  0x38, 0x00, 0x60, 0xF0, 0x00, 0x7C, 0x00, 0x3F, 0x00, 0x1F, 0xC0, 0x0F,
+  0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC,
+  0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00,
+  0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFE, 0x01, 0xF7, 0x80, 0x79, 0xF8, 0x7E,
+  0x3F, 0xFF, 0x07, 0xFF, 0x80, 0xFF, 0xC0, 0x0F, 0xC0, 0xF0, 0x01, 0x9E,
+  0x00, 0xE7, 0x80, 0x79, 0xE0, 0x3C, 0x3C, 0x0F, 0x0F, 0x03, 0xC3, 0xC1,
+  0xE0, 0x78, 0x78, 0x1E, 0x3E, 0x07, 0x8F, 0x00, 0xF3, 0xC0, 0x3D, 0xE0,
+  0x0F, 0x78, 0x01, 0xFE, 0x00, 0x7F, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
+  0xF8, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00, 0x30, 0x00, 0x08,
+  0x00, 0x02, 0x00, 0xF0, 0x08, 0x00, 0xCF, 0x00, 0x80, 0x39, 0xE0, 0x30,
+  0x0F, 0x3C, 0x07, 0x03, 0xC3, 0xC1, 0xE0, 0x78, 0x78, 0x3C, 0x0F, 0x0F,
+  0x07, 0xC3, 0xC0, 0xF1, 0xF8, 0x78, 0x1E, 0x3F, 0x1E, 0x01, 0xC7, 0xF3,
+  0xC0, 0x3D, 0xFE, 0x78, 0x07, 0xBD, 0xFE, 0x00, 0x7F, 0xBF, 0xC0, 0x0F,
+  0xE7, 0xF8, 0x01, 0xFC, 0x7E, 0x00, 0x1F, 0x8F, 0xC0, 0x03, 0xE1, 0xF0,
+  0x00, 0x7C, 0x1E, 0x00, 0x07, 0x83, 0xC0, 0x00, 0xE0, 0x70, 0x00, 0x1C,
+  0x06, 0x00, 0x01, 0x00, 0xC0, 0x00, 0x20, 0x10, 0x00, 0x04, 0x00, 0x00,
+  0x7C, 0x01, 0xE3, 0xC0, 0x3C, 0x1E, 0x07, 0xC1, 0xF0, 0x78, 0x0F, 0x0F,
+  0x80, 0xF9, 0xF0, 0x07, 0x9E, 0x00, 0x3F, 0xE0, 0x03, 0xFC, 0x00, 0x1F,
+  0x80, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x01, 0xF8, 0x00, 0x1F, 0xC0, 0x03,
+  0xFC, 0x00, 0x7D, 0xE0, 0x07, 0x9F, 0x00, 0xF8, 0xF0, 0x0F, 0x0F, 0x81,
+  0xE0, 0x78, 0x3E, 0x03, 0xC3, 0xC0, 0x3E, 0x7C, 0x01, 0xE7, 0x80, 0x0F,
+  0x00, 0x00, 0x10, 0x80, 0x01, 0xE0, 0x07, 0xF8, 0x1F, 0xFC, 0x3F, 0x7E,
+  0x7E, 0x3E, 0x7C, 0x1F, 0xF8, 0x0F, 0xF0, 0x07, 0xE0, 0x07, 0xE0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x01, 0xC0, 0x01,
+  0xC0, 0x00, 0xC0, 0x00, 0x00, 0x01, 0x0F, 0x01, 0x0E, 0x03, 0x0D, 0x05,
+  0x0A, 0x0C, 0x04, 0x0B, 0x04, 0x0C, 0x04, 0x0B, 0x04, 0x0C, 0x04, 0x0B,
+  0x04, 0x0C, 0x04, 0x0B, 0x04, 0x0C, 0x04, 0x0B, 0x04, 0x0B, 0x05, 0x0B,
+  0x04, 0x0B, 0x05, 0x0B, 0x04, 0x0B, 0x05, 0x0B, 0x04, 0x0B, 0x0F, 0x01,
+  0x2F, 0xFF, 0xFF, 0xFF, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF,
+  0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF, 0x3F, 0xFF, 0xFF,
+  0xC0, 0x00, 0x05, 0x0F, 0x04, 0x0F, 0x05, 0x0F, 0x04, 0x0F, 0x05, 0x0F,
+  0x04, 0x0F, 0x05, 0x0F, 0x04, 0x0F, 0x04, 0x10, 0x04, 0x0F, 0x04, 0x10,
+  0x04, 0x0F, 0x04, 0x10, 0x04, 0x0F, 0x04, 0x10, 0x04, 0x0F, 0x04, 0x10,
+  0x04, 0x0F, 0x04, 0x10, 0x04, 0x0F, 0x04, 0x0F, 0x05, 0x0F, 0x04, 0x0F,
+  0x05, 0x0F, 0x04, 0x0F, 0x05, 0x0F, 0x04, 0x0F, 0x05, 0x0F, 0x04, 0x0F,
+  0x05, 0xFF, 0xFF, 0xFF, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1,
+  0xE3, 0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0x8F, 0x1E, 0x3C,
+  0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xF0, 0x00, 0x7F, 0x00, 0x1F, 0xE0,
+  0x03, 0xDE, 0x00, 0xFB, 0xE0, 0x1E, 0x3C, 0x07, 0x87, 0xC1, 0xF0, 0x78,
+  0x3C, 0x07, 0x8F, 0x80, 0xF9, 0xE0, 0x0F, 0x00, 0x00, 0x44, 0x0F, 0x03,
+  0xFC, 0x79, 0xE7, 0x0E, 0xE0, 0x7E, 0x07, 0xE0, 0x7E, 0x07, 0x70, 0xE7,
+  0x1E, 0x3F, 0xC0, 0xF0, 0x00, 0x20, 0x00, 0x06, 0x00, 0x00, 0x60, 0x00,
+  0x07, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x1F, 0x80,
+  0x01, 0xFC, 0x00, 0x3F, 0xC0, 0x03, 0xDE, 0x00, 0x79, 0xE0, 0x07, 0x8E,
+  0x00, 0xF0, 0xF0, 0x0F, 0x0F, 0x00, 0xFF, 0xF8, 0x1F, 0xFF, 0x81, 0xFF,
+  0xF8, 0x3F, 0xFF, 0xC3, 0xC0, 0x3C, 0x3C, 0x01, 0xE7, 0x80, 0x1E, 0x70,
+  0x01, 0xEE, 0x00, 0x0F, 0xFF, 0x83, 0xFF, 0x8F, 0xFF, 0x3F, 0xFC, 0xF0,
+  0xFB, 0xC1, 0xEF, 0x07, 0xBC, 0x1E, 0xF0, 0xFB, 0xFF, 0xCF, 0xFE, 0x3F,
+  0xFC, 0xFF, 0xFB, 0xE3, 0xEF, 0x07, 0xFC, 0x0F, 0xF0, 0x3F, 0xC0, 0xFF,
+  0x07, 0xFC, 0x3E, 0xFF, 0xFB, 0xFF, 0xCF, 0xFE, 0x3F, 0xE0, 0x00, 0xFE,
+  0x03, 0xFF, 0x07, 0xFF, 0x1F, 0xFF, 0x1F, 0x81, 0x3E, 0x00, 0x7C, 0x00,
+  0x78, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+  0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x3E, 0x00,
+  0x1F, 0x81, 0x1F, 0xFF, 0x07, 0xFF, 0x03, 0xFF, 0x00, 0xFE, 0x7F, 0x80,
+  0x7F, 0xF0, 0x3F, 0xFE, 0x1F, 0xFF, 0x8F, 0x0F, 0xC7, 0x81, 0xF3, 0xC0,
+  0x7D, 0xE0, 0x1E, 0xF0, 0x0F, 0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xFF,
+  0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x1F, 0xF0, 0x0F, 0x78, 0x0F,
+  0xBC, 0x0F, 0x9E, 0x1F, 0x8F, 0xFF, 0xC7, 0xFF, 0x83, 0xFF, 0x81, 0xFF,
+  0x00, 0xFF, 0xEF, 0xFE, 0xFF, 0xEF, 0xFE, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
+  0x00, 0xF0, 0x0F, 0xFC, 0xFF, 0xCF, 0xFC, 0xFF, 0xCF, 0x00, 0xF0, 0x0F,
+  0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xFF, 0x8F, 0xFC, 0xFF, 0xEF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xE0, 0x3C, 0x07, 0x80,
+  0xF0, 0x1F, 0xF3, 0xFE, 0x7F, 0xCF, 0xF9, 0xE0, 0x3C, 0x07, 0x80, 0xF0,
+  0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x00, 0xE0, 0x1C, 0x01, 0x80, 0x00, 0x00,
+  0x00, 0x7E, 0x00, 0x3F, 0xF0, 0x07, 0xFF, 0x00, 0xFF, 0xF0, 0x1F, 0x81,
+  0x03, 0xE0, 0x00, 0x7C, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x0F, 0x07,
+  0xC0, 0xF0, 0x7F, 0x8F, 0x03, 0xFC, 0xF0, 0x0F, 0xEF, 0x00, 0x3E, 0xF0,
+  0x01, 0xFF, 0x80, 0x0F, 0x78, 0x00, 0xF7, 0xC0, 0x0F, 0x3E, 0x01, 0xF1,
+  0xF8, 0x3E, 0x0F, 0xFF, 0xE0, 0x7F, 0xFC, 0x03, 0xFF, 0x80, 0x0F, 0xE0,
+  0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F,
+  0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F,
+  0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0x70, 0x0F, 0x70, 0x0F, 0x30, 0x0F,
+  0x02, 0x02, 0x01, 0x03, 0x01, 0x57, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0x78,
+  0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F,
+  0x07, 0x83, 0xC1, 0xE1, 0xF1, 0xF7, 0xFB, 0xF9, 0xF8, 0xF0, 0x00, 0xF0,
+  0x7C, 0xF0, 0xF8, 0xF0, 0xF0, 0xF1, 0xF0, 0xF3, 0xE0, 0xF7, 0xC0, 0xFF,
+  0x80, 0xFF, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xFC, 0x00, 0xFE,
+  0x00, 0xFF, 0x00, 0xFF, 0x80, 0xF7, 0xC0, 0xF3, 0xC0, 0xF3, 0xE0, 0xF1,
+  0xF0, 0xF0, 0xF8, 0xF0, 0x7C, 0x70, 0x3C, 0x70, 0x3E, 0x30, 0x1F, 0x00,
+  0x06, 0x01, 0xC0, 0x38, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E,
+  0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03,
+  0xC0, 0x78, 0x0F, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x02, 0x00,
+  0x20, 0x01, 0x00, 0x10, 0x00, 0xC0, 0x08, 0x00, 0x60, 0x0C, 0x00, 0x70,
+  0x07, 0x00, 0x3C, 0x07, 0x80, 0x1E, 0x03, 0xC0, 0x0F, 0x83, 0xF0, 0x0F,
+  0xC1, 0xF8, 0x07, 0xE0, 0xFC, 0x03, 0xF8, 0xFE, 0x01, 0xFC, 0x7F, 0x81,
+  0xEF, 0x7B, 0xC0, 0xF7, 0xBD, 0xE0, 0x7B, 0xFE, 0xF0, 0x38, 0xFE, 0x3C,
+  0x3C, 0x7F, 0x1E, 0x1E, 0x1F, 0x0F, 0x0F, 0x0F, 0x87, 0x8F, 0x03, 0xC1,
+  0xE7, 0x81, 0xC0, 0xF3, 0xC0, 0xE0, 0x79, 0xC0, 0x20, 0x1D, 0xC0, 0x10,
+  0x0F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0xC0, 0x01, 0xF0, 0x00, 0xFC,
+  0x00, 0xFF, 0x00, 0x7F, 0xC0, 0x3F, 0xF0, 0x1F, 0xFC, 0x0F, 0xFE, 0x07,
+  0xFF, 0x83, 0xFD, 0xE1, 0xFE, 0x78, 0xFF, 0x3E, 0x7F, 0x8F, 0xBF, 0xC3,
+  0xFF, 0xE0, 0xFF, 0xF0, 0x3F, 0xF8, 0x0F, 0xFC, 0x03, 0xFE, 0x01, 0xFF,
+  0x00, 0x7F, 0x80, 0x1F, 0xC0, 0x07, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x09,
+  0x06, 0x0F, 0x0C, 0x0B, 0x0E, 0x09, 0x10, 0x07, 0x06, 0x06, 0x06, 0x05,
+  0x05, 0x0A, 0x05, 0x03, 0x05, 0x0C, 0x05, 0x02, 0x04, 0x0E, 0x04, 0x02,
+  0x04, 0x0E, 0x04, 0x01, 0x04, 0x10, 0x08, 0x10, 0x08, 0x10, 0x08, 0x10,
+  0x08, 0x10, 0x08, 0x10, 0x04, 0x01, 0x04, 0x0E, 0x04, 0x02, 0x04, 0x0E,
+  0x04, 0x02, 0x05, 0x0C, 0x05, 0x03, 0x05, 0x0A, 0x05, 0x05, 0x06, 0x06,
+  0x06, 0x07, 0x10, 0x09, 0x0E, 0x0B, 0x0C, 0x0E, 0x07, 0x09, 0xFF, 0x83,
+  0xFF, 0x8F, 0xFF, 0x3F, 0xFE, 0xF0, 0xFB, 0xC1, 0xFF, 0x03, 0xFC, 0x0F,
+  0xF0, 0x3F, 0xC1, 0xFF, 0x8F, 0xBF, 0xFE, 0xFF, 0xF3, 0xFF, 0x8F, 0xF8,
+  0x3C, 0x00, 0xF0, 0x03, 0xC0, 0x0F, 0x00, 0x3C, 0x00, 0xF0, 0x01, 0xC0,
+  0x07, 0x00, 0x0C, 0x00, 0x09, 0x06, 0x0F, 0x0C, 0x0B, 0x0E, 0x08, 0x12,
+  0x06, 0x06, 0x06, 0x06, 0x05, 0x05, 0x0A, 0x05, 0x03, 0x05, 0x0C, 0x05,
+  0x02, 0x04, 0x0E, 0x04, 0x01, 0x05, 0x0E, 0x09, 0x10, 0x08, 0x10, 0x08,
+  0x10, 0x08, 0x10, 0x08, 0x10, 0x08, 0x10, 0x04, 0x01, 0x04, 0x0E, 0x04,
+  0x02, 0x04, 0x0E, 0x04, 0x02, 0x05, 0x0C, 0x05, 0x03, 0x05, 0x0A, 0x05,
+  0x05, 0x06, 0x06, 0x06, 0x06, 0x11, 0x09, 0x11, 0x08, 0x11, 0x09, 0x10,
+  0xFF, 0x81, 0xFF, 0xC3, 0xFF, 0xC7, 0xFF, 0xCF, 0x0F, 0x9E, 0x0F, 0xBC,
+  0x0F, 0x78, 0x1E, 0xF0, 0x3D, 0xE0, 0x7B, 0xC1, 0xE7, 0xFF, 0xCF, 0xFF,
+  0x1F, 0xFC, 0x3F, 0xE0, 0x7F, 0x80, 0xFF, 0x81, 0xEF, 0x83, 0xCF, 0x87,
+  0x9F, 0x0F, 0x1F, 0x0E, 0x1F, 0x1C, 0x1F, 0x18, 0x1F, 0x0F, 0xF1, 0xFF,
+  0x9F, 0xF8, 0xFF, 0x0F, 0x80, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF8, 0x03,
+  0xF8, 0x1F, 0xF0, 0x7F, 0xC0, 0xFF, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x00,
+  0x78, 0x03, 0xC0, 0x3E, 0x03, 0xEF, 0xFF, 0x3F, 0xF0, 0xFF, 0x03, 0xE0,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x80, 0x1E, 0x00, 0x78,
+  0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E,
+  0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07,
+  0x80, 0x0E, 0x00, 0x38, 0x00, 0x60, 0xF0, 0x00, 0x7C, 0x00, 0x3F, 0x00,
+  0x1F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F,
+  0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC,
+  0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFE, 0x01, 0xF7, 0x80,
+  0x79, 0xF8, 0x7E, 0x3F, 0xFF, 0x07, 0xFF, 0x80, 0xFF, 0xC0, 0x0F, 0xC0,
+  0xF0, 0x01, 0x9E, 0x00, 0xE7, 0x80, 0x79, 0xE0, 0x3C, 0x3C, 0x0F, 0x0F,
+  0x07, 0xC3, 0xC1, 0xE0, 0x78, 0x78, 0x1E, 0x3C, 0x07, 0x8F, 0x00, 0xF3,
+  0xC0, 0x3D, 0xE0, 0x0F, 0x78, 0x01, 0xFE, 0x00, 0x7F, 0x00, 0x0F, 0xC0,
+  0x03, 0xE0, 0x00, 0xF8, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x01, 0xC0, 0x00,
+  0x30, 0x00, 0x08, 0x00, 0x02, 0x00, 0xF0, 0x08, 0x00, 0xCF, 0x00, 0x80,
+  0x39, 0xE0, 0x30, 0x0F, 0x3C, 0x07, 0x03, 0xC3, 0xC1, 0xE0, 0x78, 0x78,
+  0x3C, 0x0F, 0x0F, 0x07, 0xC3, 0xC0, 0xF1, 0xF8, 0x78, 0x1E, 0x3F, 0x1E,
+  0x01, 0xE7, 0xF3, 0xC0, 0x3D, 0xFE, 0x78, 0x07, 0xBD, 0xFE, 0x00, 0x7F,
+  0xBF, 0xC0, 0x0F, 0xE7, 0xF8, 0x01, 0xFC, 0x7E, 0x00, 0x1F, 0x8F, 0xC0,
+  0x03, 0xE1, 0xF0, 0x00, 0x7C, 0x1E, 0x00, 0x07, 0x03, 0xC0, 0x00, 0xE0,
+  0x70, 0x00, 0x1C, 0x06, 0x00, 0x01, 0x00, 0xC0, 0x00, 0x20, 0x10, 0x00,
+  0x04, 0x00, 0x00, 0x7C, 0x03, 0xE3, 0xC0, 0x3C, 0x1E, 0x07, 0xC1, 0xF0,
+  0x78, 0x0F, 0x0F, 0x00, 0xF9, 0xF0, 0x07, 0x9E, 0x00, 0x3F, 0xE0, 0x03,
+  0xFC, 0x00, 0x1F, 0x80, 0x01, 0xF8, 0x00, 0x0F, 0x00, 0x01, 0xF8, 0x00,
+  0x3F, 0xC0, 0x03, 0xFC, 0x00, 0x7D, 0xE0, 0x07, 0x9E, 0x00, 0xF8, 0xF0,
+  0x1F, 0x0F, 0x81, 0xE0, 0x78, 0x3E, 0x03, 0xC3, 0xC0, 0x3E, 0x78, 0x01,
+  0xEF, 0x80, 0x0F, 0x00, 0x00, 0x30, 0x80, 0x01, 0xE0, 0x07, 0xF8, 0x1F,
+  0xFC, 0x3F, 0x7E, 0x7E, 0x3E, 0x7C, 0x1F, 0xF0, 0x0F, 0xF0, 0x07, 0xE0,
+  0x07, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0,
+  0x01, 0xC0, 0x01, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x01, 0x0F, 0x01, 0x0E,
+  0x03, 0x0D, 0x05, 0x0A, 0x0C, 0x04, 0x0B, 0x04, 0x0C, 0x04, 0x0B, 0x04,
+  0x0C, 0x04, 0x0B, 0x04, 0x0C, 0x04, 0x0B, 0x04, 0x0C, 0x04, 0x0B, 0x04,
+  0x0B, 0x05, 0x0B, 0x04, 0x0B, 0x05, 0x0B, 0x04, 0x0B, 0x05, 0x0B, 0x04,
+  0x0B, 0x0F, 0x01, 0x2F, 0x0C, 0xF7, 0xDF, 0x79, 0xE7, 0x9E, 0x79, 0xE7,
+  0xBE, 0xF3, 0x88, 0x38, 0xF3, 0xE7, 0x9E, 0x79, 0xE7, 0x9E, 0x79, 0xF3,
+  0xCF, 0x0C, 0x00, 0x70, 0xC3, 0xCF, 0x3E, 0x79, 0xE7, 0x9E, 0x79, 0xE7,
+  0x9F, 0x3C, 0x70, 0x47, 0x3D, 0xF7, 0x9E, 0x79, 0xE7, 0x9E, 0x7B, 0xEF,
+  0x3C, 0xC0 };
+
+const PackedGlyph rodondo_20pt_glyphs[] PROGMEM = {
+  {     0,   1,   1,  11,   0,    0, GlyphEncoding::Bits },   // 0x20 ' '
+  {     1,   4,  24,   6,   1,  -23, GlyphEncoding::Bits },   // 0x21 '!'
+  {    13,   9,   6,  11,   1,  -25, GlyphEncoding::Bits },   // 0x22 '"'
+  {    20,  24,  24,  26,   1,  -23, GlyphEncoding::Runs },   // 0x23 '#'
+  {    89,  13,  29,  15,   1,  -26, GlyphEncoding::Bits },   // 0x24 '$'
+  {   137,  24,  24,  26,   1,  -23, GlyphEncoding::Bits },   // 0x25 '%'
+  {   209,  19,  24,  22,   1,  -23, GlyphEncoding::Bits },   // 0x26 '&'
+  {   266,   4,   6,   6,   1,  -25, GlyphEncoding::Bits },   // 0x27 '''
+  {   269,   6,  29,   7,   1,  -25, GlyphEncoding::Bits },   // 0x28 '('
+  {   291,   6,  29,   8,   1,  -25, GlyphEncoding::Bits },   // 0x29 ')'
+  {   313,  12,  13,  14,   1,  -27, GlyphEncoding::Bits },   // 0x2A '*'
+  {   333,  15,  14,  17,   1,  -18, GlyphEncoding::Runs },   // 0x2B '+'
+  {   356,   4,   6,   6,   1,   -2, GlyphEncoding::Bits },   // 0x2C ','
+  {   359,  11,   4,  13,   1,  -13, GlyphEncoding::Bits },   // 0x2D '-'
+  {   365,   5,   5,   7,   1,   -4, GlyphEncoding::Bits },   // 0x2E '.'
+  {   369,  19,  30,  21,   1,  -26, GlyphEncoding::Runs },   // 0x2F '/'
+  {   430,  17,  24,  19,   1,  -23, GlyphEncoding::Bits },   // 0x30 '0'
+  {   481,   4,  24,   6,   1,  -23, GlyphEncoding::Runs },   // 0x31 '1'
+  {   489,  15,  24,  17,   1,  -23, GlyphEncoding::Bits },   // 0x32 '2'
+  {   534,  14,  24,  16,   1,  -23, GlyphEncoding::Bits },   // 0x33 '3'
+  {   576,  19,  25,  22,   1,  -24, GlyphEncoding::Runs },   // 0x34 '4'
+  {   633,  15,  24,  18,   1,  -23, GlyphEncoding::Bits },   // 0x35 '5'
+  {   678,  15,  25,  17,   1,  -24, GlyphEncoding::Bits },   // 0x36 '6'
+  {   725,  15,  24,  18,   1,  -23, GlyphEncoding::Bits },   // 0x37 '7'
+  {   770,  15,  24,  17,   1,  -23, GlyphEncoding::Bits },   // 0x38 '8'
+  {   815,  15,  25,  17,   1,  -23, GlyphEncoding::Bits },   // 0x39 '9'
+  {   862,   5,  12,   7,   1,  -15, GlyphEncoding::Bits },   // 0x3A ':'
+  {   870,   5,  14,   7,   1,  -12, GlyphEncoding::Bits },   // 0x3B ';'
+  {   879,  11,  19,  13,   1,  -20, GlyphEncoding::Bits },   // 0x3C '<'
+  {   906,  14,  11,  16,   1,  -17, GlyphEncoding::Runs },   // 0x3D '='
+  {   910,  11,  19,  13,   1,  -20, GlyphEncoding::Bits },   // 0x3E '>'
+  {   937,  16,  24,  18,   1,  -23, GlyphEncoding::Bits },   // 0x3F '?'
+  {   985,  23,  24,  25,   1,  -23, GlyphEncoding::Bits },   // 0x40 '@'
+  {  1054,  20,  25,  20,   0,  -24, GlyphEncoding::Bits },   // 0x41 'A'
+  {  1117,  14,  24,  16,   1,  -23, GlyphEncoding::Bits },   // 0x42 'B'
+  {  1159,  16,  24,  18,   1,  -23, GlyphEncoding::Bits },   // 0x43 'C'
+  {  1207,  17,  24,  19,   1,  -23, GlyphEncoding::Bits },   // 0x44 'D'
+  {  1258,  12,  24,  14,   2,  -23, GlyphEncoding::Bits },   // 0x45 'E'
+  {  1294,  11,  25,  13,   2,  -23, GlyphEncoding::Bits },   // 0x46 'F'
+  {  1329,  20,  24,  22,   1,  -23, GlyphEncoding::Bits },   // 0x47 'G'
+  {  1389,  16,  24,  18,   1,  -23, GlyphEncoding::Bits },   // 0x48 'H'
+  {  1437,   4,  24,   8,   2,  -23, GlyphEncoding::Runs },   // 0x49 'I'
+  {  1443,   9,  25,  12,   1,  -24, GlyphEncoding::Bits },   // 0x4A 'J'
+  {  1472,  16,  24,  17,   1,  -23, GlyphEncoding::Bits },   // 0x4B 'K'
+  {  1520,  11,  25,  13,   1,  -24, GlyphEncoding::Bits },   // 0x4C 'L'
+  {  1555,  25,  25,  25,   0,  -23, GlyphEncoding::Bits },   // 0x4D 'M'
+  {  1634,  17,  25,  19,   1,  -23, GlyphEncoding::Bits },   // 0x4E 'N'
+  {  1688,  24,  24,  26,   1,  -23, GlyphEncoding::Runs },   // 0x4F 'O'
+  {  1759,  14,  24,  16,   1,  -23, GlyphEncoding::Bits },   // 0x50 'P'
+  {  1801,  24,  24,  26,   1,  -23, GlyphEncoding::Runs },   // 0x51 'Q'
+  {  1869,  15,  24,  16,   1,  -23, GlyphEncoding::Bits },   // 0x52 'R'
+  {  1914,  13,  24,  15,   1,  -23, GlyphEncoding::Bits },   // 0x53 'S'
+  {  1953,  14,  24,  16,   1,  -23, GlyphEncoding::Bits },   // 0x54 'T'
+  {  1995,  18,  24,  20,   1,  -23, GlyphEncoding::Bits },   // 0x55 'U'
+  {  2049,  18,  24,  18,   0,  -23, GlyphEncoding::Bits },   // 0x56 'V'
+  {  2103,  27,  24,  27,   0,  -23, GlyphEncoding::Bits },   // 0x57 'W'
+  {  2184,  20,  25,  21,   0,  -23, GlyphEncoding::Bits },   // 0x58 'X'
+  {  2247,  16,  25,  18,   1,  -23, GlyphEncoding::Bits },   // 0x59 'Y'
+  {  2297,  16,  24,  18,   1,  -23, GlyphEncoding::Runs },   // 0x5A 'Z'
+  {  2341,   6,  31,   8,   1,  -26, GlyphEncoding::Bits },   // 0x5B '['
+  {  2365,  19,  30,  21,   1,  -26, GlyphEncoding::Runs },   // 0x5C '\'
+  {  2425,   7,  31,   9,   1,  -26, GlyphEncoding::Bits },   // 0x5D ']'
+  {  2453,  19,  11,  21,   1,  -26, GlyphEncoding::Bits },   // 0x5E '^'
+  {  2480,  17,   4,  19,   1,    1, GlyphEncoding::Runs },   // 0x5F '_'
+  {  2482,  12,  12,  24,   6,  -26, GlyphEncoding::Bits },   // 0x60 '`'
+  {  2500,  20,  24,  20,   0,  -23, GlyphEncoding::Bits },   // 0x61 'a'
+  {  2560,  14,  24,  16,   1,  -23, GlyphEncoding::Bits },   // 0x62 'b'
+  {  2602,  16,  24,  18,   1,  -23, GlyphEncoding::Bits },   // 0x63 'c'
+  {  2650,  17,  24,  19,   1,  -23, GlyphEncoding::Bits },   // 0x64 'd'
+  {  2701,  12,  24,  14,   2,  -23, GlyphEncoding::Bits },   // 0x65 'e'
+  {  2737,  11,  25,  13,   2,  -23, GlyphEncoding::Bits },   // 0x66 'f'
+  {  2772,  20,  24,  22,   1,  -23, GlyphEncoding::Bits },   // 0x67 'g'
+  {  2832,  16,  24,  18,   1,  -23, GlyphEncoding::Bits },   // 0x68 'h'
+  {  2880,   4,  24,   8,   2,  -23, GlyphEncoding::Runs },   // 0x69 'i'
+  {  2886,   9,  25,  12,   1,  -24, GlyphEncoding::Bits },   // 0x6A 'j'
+  {  2915,  16,  24,  17,   1,  -23, GlyphEncoding::Bits },   // 0x6B 'k'
+  {  2963,  11,  25,  13,   1,  -24, GlyphEncoding::Bits },   // 0x6C 'l'
+  {  2998,  25,  25,  25,   0,  -23, GlyphEncoding::Bits },   // 0x6D 'm'
+  {  3077,  17,  25,  19,   1,  -23, GlyphEncoding::Bits },   // 0x6E 'n'
+  {  3131,  24,  24,  26,   1,  -23, GlyphEncoding::Runs },   // 0x6F 'o'
+  {  3202,  14,  24,  16,   1,  -23, GlyphEncoding::Bits },   // 0x70 'p'
+  {  3244,  24,  24,  26,   1,  -23, GlyphEncoding::Runs },   // 0x71 'q'
+  {  3312,  15,  24,  16,   1,  -23, GlyphEncoding::Bits },   // 0x72 'r'
+  {  3357,  13,  24,  15,   1,  -23, GlyphEncoding::Bits },   // 0x73 's'
+  {  3396,  14,  24,  16,   1,  -23, GlyphEncoding::Bits },   // 0x74 't'
+  {  3438,  18,  24,  20,   1,  -23, GlyphEncoding::Bits },   // 0x75 'u'
+  {  3492,  18,  24,  18,   0,  -23, GlyphEncoding::Bits },   // 0x76 'v'
+  {  3546,  27,  24,  26,   0,  -23, GlyphEncoding::Bits },   // 0x77 'w'
+  {  3627,  20,  25,  20,   0,  -23, GlyphEncoding::Bits },   // 0x78 'x'
+  {  3690,  16,  25,  18,   1,  -23, GlyphEncoding::Bits },   // 0x79 'y'
+  {  3740,  16,  24,  18,   1,  -23, GlyphEncoding::Runs },   // 0x7A 'z'
+  {  3784,   6,  29,   7,   1,  -25, GlyphEncoding::Bits },   // 0x7B '{'
+  {  3806,   4,  28,   6,   1,  -25, GlyphEncoding::Runs },   // 0x7C '|'
+  {  3808,   6,  29,   7,   1,  -25, GlyphEncoding::Bits } }; // 0x7D '}'
+
+const PackedFont rodondo_20pt PROGMEM = {
+  rodondo_20pt_bitmaps,
+  rodondo_20pt_glyphs,
+  0x20, 0x7D, 30 };
+
+// 94 glyphs, 3830 bytes of bitmaps, 3932 bytes bit-packed
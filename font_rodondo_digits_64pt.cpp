@@ -0,0 +1,198 @@
+// Generated by tools/font_subset, do not edit
+#include <sys/pgmspace.h>
+#include "fonts.hpp"
+
+// Rodondo font
+// Created by Olly Wood @olllywood
+
+const uint8_t rodondo_digits_64pt_bitmaps[] PROGMEM = {
+  0x11, 0x12, 0x0B, 0x18, 0x09, 0x19, 0x08, 0x1B, 0x06, 0x1C, 0x06, 0x1D,
+  0x05, 0x1D, 0x05, 0x1D, 0x06, 0x1C, 0x06, 0x1B, 0x08, 0x19, 0x09, 0x18,
+  0x0B, 0x0F, 0x08, 0x1B, 0x0E, 0x16, 0x12, 0x12, 0x16, 0x0F, 0x18, 0x0D,
+  0x1A, 0x0B, 0x1C, 0x09, 0x1E, 0x07, 0x0F, 0x02, 0x0F, 0x05, 0x0C, 0x0A,
+  0x0B, 0x05, 0x0A, 0x0D, 0x0B, 0x03, 0x0A, 0x10, 0x09, 0x03, 0x0A, 0x10,
+  0x0A, 0x02, 0x09, 0x12, 0x09, 0x01, 0x09, 0x14, 0x08, 0x01, 0x09, 0x14,
+  0x12, 0x14, 0x12, 0x14, 0x11, 0x15, 0x11, 0x15, 0x12, 0x14, 0x12, 0x14,
+  0x12, 0x14, 0x12, 0x14, 0x08, 0x02, 0x09, 0x12, 0x09, 0x02, 0x0A, 0x10,
+  0x0A, 0x02, 0x0A, 0x10, 0x09, 0x04, 0x0A, 0x0D, 0x0B, 0x04, 0x0C, 0x0A,
+  0x0B, 0x06, 0x0F, 0x02, 0x0F, 0x07, 0x1E, 0x09, 0x1C, 0x0B, 0x1A, 0x0D,
+  0x18, 0x0F, 0x16, 0x11, 0x13, 0x15, 0x0F, 0x1A, 0x09, 0x0F, 0x19, 0x02,
+  0x2D, 0x0C, 0x25, 0x12, 0x20, 0x16, 0x1D, 0x18, 0x1B, 0x1A, 0x19, 0x1C,
+  0x17, 0x1E, 0x15, 0x20, 0x13, 0x22, 0x11, 0x24, 0x0F, 0x26, 0x0E, 0x26,
+  0x0D, 0x10, 0x08, 0x10, 0x0C, 0x0E, 0x0C, 0x0E, 0x0B, 0x0E, 0x0E, 0x0E,
+  0x09, 0x0E, 0x10, 0x0E, 0x08, 0x0E, 0x10, 0x0E, 0x08, 0x0D, 0x12, 0x0D,
+  0x07, 0x0D, 0x14, 0x0D, 0x06, 0x0D, 0x14, 0x0D, 0x05, 0x0D, 0x16, 0x0D,
+  0x04, 0x0D, 0x16, 0x0D, 0x04, 0x0C, 0x18, 0x0C, 0x03, 0x0D, 0x18, 0x0D,
+  0x02, 0x0D, 0x18, 0x0D, 0x02, 0x0C, 0x1A, 0x0C, 0x02, 0x0C, 0x1A, 0x0C,
+  0x02, 0x0C, 0x1A, 0x0C, 0x01, 0x0D, 0x1A, 0x19, 0x1C, 0x18, 0x1C, 0x18,
+  0x1C, 0x18, 0x1C, 0x18, 0x1C, 0x18, 0x1C, 0x18, 0x1C, 0x18, 0x1C, 0x18,
+  0x1C, 0x18, 0x1C, 0x18, 0x1C, 0x18, 0x1C, 0x18, 0x1C, 0x18, 0x1C, 0x18,
+  0x1C, 0x18, 0x1C, 0x18, 0x1C, 0x19, 0x1A, 0x0D, 0x01, 0x0C, 0x1A, 0x0C,
+  0x02, 0x0C, 0x1A, 0x0C, 0x02, 0x0C, 0x1A, 0x0C, 0x02, 0x0D, 0x18, 0x0D,
+  0x03, 0x0C, 0x18, 0x0C, 0x04, 0x0C, 0x18, 0x0C, 0x04, 0x0D, 0x16, 0x0D,
+  0x04, 0x0D, 0x16, 0x0D, 0x05, 0x0D, 0x14, 0x0D, 0x06, 0x0D, 0x14, 0x0D,
+  0x07, 0x0D, 0x12, 0x0D, 0x08, 0x0E, 0x10, 0x0E, 0x09, 0x0E, 0x0E, 0x0E,
+  0x0A, 0x0E, 0x0E, 0x0E, 0x0B, 0x0F, 0x0A, 0x0F, 0x0C, 0x10, 0x08, 0x10,
+  0x0D, 0x26, 0x0E, 0x26, 0x0F, 0x24, 0x11, 0x22, 0x13, 0x20, 0x15, 0x1E,
+  0x17, 0x1C, 0x19, 0x1A, 0x1B, 0x18, 0x1E, 0x14, 0x22, 0x10, 0x26, 0x0C,
+  0x14, 0x00, 0xFF, 0xFF, 0xF6, 0x01, 0x0B, 0x01, 0x0B, 0x01, 0x0B, 0x02,
+  0x0A, 0x03, 0x09, 0x03, 0x09, 0x04, 0x08, 0x05, 0x07, 0x06, 0x06, 0x07,
+  0x05, 0x08, 0x04, 0x0A, 0x02, 0x11, 0x0B, 0x21, 0x11, 0x1C, 0x15, 0x19,
+  0x17, 0x16, 0x1B, 0x13, 0x1D, 0x11, 0x1F, 0x0F, 0x21, 0x0E, 0x21, 0x0D,
+  0x23, 0x0E, 0x22, 0x0F, 0x20, 0x10, 0x09, 0x07, 0x10, 0x11, 0x05, 0x0B,
+  0x0E, 0x13, 0x02, 0x0D, 0x0D, 0x23, 0x0D, 0x22, 0x0D, 0x23, 0x0C, 0x23,
+  0x0C, 0x23, 0x0C, 0x23, 0x0C, 0x23, 0x0C, 0x23, 0x0C, 0x23, 0x0C, 0x22,
+  0x0D, 0x22, 0x0D, 0x21, 0x0D, 0x22, 0x0D, 0x21, 0x0E, 0x20, 0x0E, 0x21,
+  0x0E, 0x20, 0x0E, 0x21, 0x0E, 0x20, 0x0E, 0x20, 0x0E, 0x21, 0x0E, 0x20,
+  0x0E, 0x21, 0x0D, 0x21, 0x0E, 0x20, 0x0E, 0x21, 0x0E, 0x20, 0x0E, 0x21,
+  0x0D, 0x21, 0x0E, 0x20, 0x0E, 0x21, 0x0E, 0x20, 0x0E, 0x20, 0x0E, 0x21,
+  0x0E, 0x20, 0x0E, 0x21, 0x0D, 0x21, 0x0E, 0x20, 0x0E, 0x21, 0x0E, 0x20,
+  0x0E, 0x21, 0x0D, 0x21, 0x0E, 0x20, 0x0E, 0x21, 0x0E, 0x20, 0x0E, 0x21,
+  0x0D, 0x21, 0x0E, 0x20, 0x0E, 0x21, 0x19, 0x15, 0x1E, 0x11, 0x20, 0x0E,
+  0x23, 0x0B, 0x25, 0x0A, 0x26, 0x08, 0x28, 0x07, 0x29, 0x05, 0x2B, 0x03,
+  0x2C, 0x03, 0x2D, 0x01, 0x2E, 0x01, 0x11, 0x0C, 0x1F, 0x11, 0x1A, 0x15,
+  0x16, 0x19, 0x13, 0x1B, 0x11, 0x1D, 0x0F, 0x1F, 0x0D, 0x21, 0x0B, 0x23,
+  0x09, 0x24, 0x09, 0x25, 0x07, 0x26, 0x07, 0x0F, 0x08, 0x10, 0x08, 0x0C,
+  0x0B, 0x0E, 0x0B, 0x08, 0x0D, 0x0E, 0x0E, 0x03, 0x0F, 0x0D, 0x21, 0x0C,
+  0x21, 0x0C, 0x21, 0x0C, 0x22, 0x0B, 0x22, 0x0B, 0x22, 0x0B, 0x21, 0x0C,
+  0x21, 0x0C, 0x21, 0x0C, 0x20, 0x0D, 0x20, 0x0D, 0x1F, 0x0D, 0x1F, 0x0E,
+  0x1D, 0x10, 0x16, 0x16, 0x17, 0x16, 0x17, 0x15, 0x18, 0x14, 0x19, 0x13,
+  0x1A, 0x12, 0x1B, 0x12, 0x1B, 0x13, 0x1A, 0x14, 0x19, 0x15, 0x18, 0x16,
+  0x17, 0x16, 0x1E, 0x10, 0x1F, 0x0E, 0x20, 0x0E, 0x20, 0x0D, 0x20, 0x0D,
+  0x21, 0x0D, 0x20, 0x0D, 0x21, 0x0C, 0x21, 0x0C, 0x21, 0x0C, 0x21, 0x0C,
+  0x08, 0x04, 0x15, 0x0C, 0x05, 0x07, 0x15, 0x0C, 0x01, 0x0B, 0x15, 0x18,
+  0x15, 0x19, 0x13, 0x1A, 0x13, 0x0D, 0x01, 0x0D, 0x11, 0x0D, 0x02, 0x0E,
+  0x0F, 0x0E, 0x02, 0x0F, 0x0D, 0x0F, 0x03, 0x0F, 0x0A, 0x10, 0x04, 0x12,
+  0x05, 0x12, 0x05, 0x27, 0x06, 0x26, 0x08, 0x25, 0x09, 0x23, 0x0B, 0x21,
+  0x0D, 0x1F, 0x0F, 0x1D, 0x11, 0x1B, 0x14, 0x17, 0x17, 0x14, 0x1C, 0x0F,
+  0x22, 0x01, 0x01, 0x03, 0x15, 0x2D, 0x01, 0x3B, 0x01, 0x3A, 0x02, 0x39,
+  0x03, 0x39, 0x03, 0x38, 0x04, 0x37, 0x05, 0x36, 0x06, 0x36, 0x06, 0x35,
+  0x07, 0x34, 0x08, 0x34, 0x08, 0x33, 0x09, 0x32, 0x0A, 0x31, 0x0B, 0x31,
+  0x0B, 0x30, 0x0C, 0x2F, 0x0D, 0x2F, 0x0D, 0x2E, 0x0E, 0x2D, 0x0F, 0x2C,
+  0x10, 0x2C, 0x10, 0x2B, 0x11, 0x2A, 0x12, 0x29, 0x13, 0x29, 0x13, 0x28,
+  0x14, 0x27, 0x15, 0x27, 0x15, 0x26, 0x16, 0x25, 0x17, 0x24, 0x18, 0x24,
+  0x18, 0x23, 0x19, 0x22, 0x1A, 0x22, 0x1A, 0x21, 0x1B, 0x20, 0x1C, 0x1F,
+  0x10, 0x01, 0x0C, 0x1F, 0x0F, 0x02, 0x0C, 0x1E, 0x10, 0x02, 0x0C, 0x1D,
+  0x10, 0x03, 0x0C, 0x1C, 0x10, 0x04, 0x0C, 0x1C, 0x10, 0x04, 0x0C, 0x1B,
+  0x10, 0x05, 0x0C, 0x1A, 0x10, 0x06, 0x0C, 0x1A, 0x10, 0x06, 0x0C, 0x19,
+  0x10, 0x07, 0x0C, 0x18, 0x10, 0x08, 0x0C, 0x17, 0x11, 0x08, 0x0C, 0x17,
+  0x10, 0x09, 0x0C, 0x16, 0x28, 0x13, 0x2B, 0x11, 0x2D, 0x0E, 0x30, 0x0B,
+  0x32, 0x09, 0x34, 0x08, 0x35, 0x06, 0x37, 0x04, 0x38, 0x03, 0x3A, 0x02,
+  0x77, 0x22, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30,
+  0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30, 0x0C, 0x30,
+  0x0C, 0x30, 0x0C, 0x0E, 0x0F, 0x22, 0x0F, 0x22, 0x0F, 0x21, 0x0F, 0x22,
+  0x0F, 0x21, 0x10, 0x20, 0x10, 0x20, 0x11, 0x1F, 0x12, 0x1E, 0x12, 0x1D,
+  0x14, 0x1C, 0x15, 0x19, 0x17, 0x0D, 0x24, 0x0D, 0x24, 0x0D, 0x23, 0x0D,
+  0x24, 0x0D, 0x24, 0x0D, 0x23, 0x0D, 0x24, 0x0D, 0x24, 0x0D, 0x23, 0x0D,
+  0x24, 0x0D, 0x24, 0x0D, 0x23, 0x0D, 0x24, 0x0D, 0x24, 0x0D, 0x23, 0x17,
+  0x1A, 0x1A, 0x17, 0x1D, 0x13, 0x20, 0x11, 0x21, 0x10, 0x22, 0x0E, 0x25,
+  0x0C, 0x26, 0x0B, 0x26, 0x0A, 0x28, 0x09, 0x29, 0x08, 0x2A, 0x06, 0x13,
+  0x06, 0x12, 0x06, 0x10, 0x0C, 0x10, 0x05, 0x0F, 0x0E, 0x0F, 0x04, 0x0E,
+  0x12, 0x0E, 0x03, 0x0E, 0x12, 0x0E, 0x24, 0x0D, 0x25, 0x0D, 0x24, 0x0D,
+  0x25, 0x0C, 0x25, 0x0C, 0x25, 0x0C, 0x25, 0x0C, 0x01, 0x0C, 0x18, 0x0C,
+  0x01, 0x0C, 0x18, 0x0C, 0x01, 0x0C, 0x18, 0x0C, 0x01, 0x0C, 0x18, 0x0C,
+  0x01, 0x0C, 0x18, 0x0C, 0x01, 0x0D, 0x16, 0x0D, 0x02, 0x0C, 0x16, 0x0D,
+  0x02, 0x0D, 0x14, 0x0D, 0x03, 0x0E, 0x12, 0x0E, 0x04, 0x0E, 0x10, 0x0F,
+  0x04, 0x0F, 0x0E, 0x0F, 0x06, 0x10, 0x0A, 0x11, 0x06, 0x14, 0x02, 0x14,
+  0x08, 0x28, 0x09, 0x28, 0x0A, 0x26, 0x0C, 0x24, 0x0E, 0x22, 0x10, 0x20,
+  0x12, 0x1E, 0x15, 0x1B, 0x17, 0x18, 0x1B, 0x14, 0x20, 0x0E, 0x29, 0x02,
+  0x18, 0x1D, 0x01, 0x2D, 0x03, 0x2C, 0x03, 0x2B, 0x05, 0x2A, 0x05, 0x29,
+  0x06, 0x28, 0x08, 0x27, 0x08, 0x26, 0x09, 0x25, 0x0A, 0x25, 0x0A, 0x24,
+  0x0B, 0x23, 0x0C, 0x23, 0x0C, 0x22, 0x0D, 0x22, 0x0D, 0x21, 0x0D, 0x21,
+  0x0E, 0x21, 0x0E, 0x20, 0x0E, 0x20, 0x0F, 0x20, 0x0E, 0x20, 0x0E, 0x21,
+  0x0E, 0x20, 0x0E, 0x20, 0x0E, 0x21, 0x0E, 0x20, 0x0E, 0x20, 0x0F, 0x20,
+  0x0E, 0x20, 0x12, 0x1D, 0x16, 0x18, 0x19, 0x15, 0x1C, 0x13, 0x1D, 0x11,
+  0x1F, 0x0F, 0x21, 0x0E, 0x22, 0x0C, 0x24, 0x0B, 0x25, 0x09, 0x27, 0x07,
+  0x29, 0x06, 0x11, 0x07, 0x11, 0x05, 0x10, 0x0B, 0x10, 0x04, 0x0E, 0x0E,
+  0x0F, 0x03, 0x0E, 0x11, 0x0D, 0x03, 0x0D, 0x12, 0x0E, 0x02, 0x0C, 0x14,
+  0x0D, 0x01, 0x0D, 0x15, 0x0C, 0x01, 0x0D, 0x15, 0x0C, 0x01, 0x0C, 0x16,
+  0x19, 0x17, 0x18, 0x17, 0x18, 0x17, 0x18, 0x17, 0x18, 0x17, 0x18, 0x16,
+  0x19, 0x16, 0x0C, 0x01, 0x0D, 0x15, 0x0C, 0x02, 0x0C, 0x14, 0x0D, 0x02,
+  0x0D, 0x13, 0x0D, 0x02, 0x0E, 0x11, 0x0D, 0x04, 0x0E, 0x0F, 0x0E, 0x04,
+  0x0F, 0x0C, 0x10, 0x05, 0x11, 0x07, 0x11, 0x06, 0x29, 0x07, 0x27, 0x08,
+  0x26, 0x0A, 0x24, 0x0C, 0x22, 0x0E, 0x20, 0x10, 0x1E, 0x12, 0x1C, 0x15,
+  0x19, 0x18, 0x15, 0x1C, 0x11, 0x21, 0x0A, 0x13, 0x00, 0x31, 0x01, 0x2F,
+  0x02, 0x2F, 0x03, 0x2D, 0x04, 0x2D, 0x05, 0x2B, 0x07, 0x2A, 0x08, 0x28,
+  0x0A, 0x27, 0x0C, 0x24, 0x0F, 0x22, 0x12, 0x1E, 0x24, 0x0D, 0x23, 0x0D,
+  0x24, 0x0D, 0x23, 0x0D, 0x24, 0x0D, 0x23, 0x0D, 0x24, 0x0D, 0x23, 0x0E,
+  0x23, 0x0D, 0x23, 0x0E, 0x23, 0x0D, 0x23, 0x0E, 0x23, 0x0D, 0x23, 0x0E,
+  0x23, 0x0D, 0x23, 0x0E, 0x23, 0x0D, 0x24, 0x0D, 0x23, 0x0D, 0x24, 0x0D,
+  0x23, 0x0D, 0x24, 0x0D, 0x23, 0x0D, 0x24, 0x0D, 0x23, 0x0D, 0x24, 0x0D,
+  0x23, 0x0D, 0x24, 0x0D, 0x23, 0x0D, 0x24, 0x0D, 0x23, 0x0E, 0x23, 0x0D,
+  0x23, 0x0E, 0x23, 0x0D, 0x23, 0x0E, 0x23, 0x0D, 0x23, 0x0E, 0x23, 0x0D,
+  0x23, 0x0E, 0x23, 0x0D, 0x23, 0x0E, 0x23, 0x0D, 0x24, 0x0D, 0x23, 0x0D,
+  0x24, 0x0D, 0x23, 0x0D, 0x24, 0x0D, 0x23, 0x0D, 0x24, 0x0D, 0x23, 0x0D,
+  0x24, 0x0D, 0x23, 0x0E, 0x23, 0x0D, 0x23, 0x0E, 0x23, 0x0D, 0x23, 0x0E,
+  0x23, 0x0D, 0x23, 0x0E, 0x23, 0x0D, 0x23, 0x0E, 0x23, 0x0D, 0x23, 0x0E,
+  0x23, 0x0D, 0x24, 0x12, 0x0C, 0x21, 0x11, 0x1D, 0x15, 0x1A, 0x18, 0x16,
+  0x1B, 0x14, 0x1D, 0x12, 0x1F, 0x11, 0x20, 0x0F, 0x21, 0x0E, 0x23, 0x0D,
+  0x24, 0x0B, 0x25, 0x0B, 0x0F, 0x07, 0x0F, 0x0A, 0x0E, 0x0B, 0x0E, 0x09,
+  0x0D, 0x0D, 0x0D, 0x09, 0x0D, 0x0E, 0x0C, 0x09, 0x0C, 0x0F, 0x0D, 0x08,
+  0x0C, 0x10, 0x0C, 0x08, 0x0B, 0x11, 0x0C, 0x08, 0x0B, 0x11, 0x0C, 0x08,
+  0x0B, 0x11, 0x0C, 0x08, 0x0C, 0x10, 0x0C, 0x08, 0x0C, 0x0F, 0x0D, 0x08,
+  0x0C, 0x0F, 0x0C, 0x09, 0x0D, 0x0D, 0x0D, 0x09, 0x0E, 0x0B, 0x0E, 0x0A,
+  0x0E, 0x09, 0x0F, 0x0A, 0x10, 0x05, 0x10, 0x0B, 0x25, 0x0C, 0x23, 0x0D,
+  0x23, 0x0E, 0x21, 0x10, 0x1F, 0x11, 0x1F, 0x10, 0x21, 0x0E, 0x23, 0x0C,
+  0x25, 0x0A, 0x27, 0x09, 0x28, 0x07, 0x29, 0x07, 0x11, 0x07, 0x12, 0x05,
+  0x10, 0x0C, 0x0F, 0x05, 0x0E, 0x0F, 0x0F, 0x03, 0x0E, 0x11, 0x0E, 0x03,
+  0x0D, 0x13, 0x0D, 0x03, 0x0D, 0x14, 0x0D, 0x01, 0x0D, 0x15, 0x0D, 0x01,
+  0x0D, 0x16, 0x0C, 0x01, 0x0C, 0x17, 0x0C, 0x01, 0x0C, 0x17, 0x0C, 0x01,
+  0x0C, 0x17, 0x0C, 0x01, 0x0C, 0x17, 0x19, 0x17, 0x19, 0x17, 0x0C, 0x01,
+  0x0C, 0x17, 0x0C, 0x01, 0x0C, 0x17, 0x0C, 0x01, 0x0D, 0x16, 0x0C, 0x01,
+  0x0D, 0x15, 0x0D, 0x02, 0x0D, 0x13, 0x0E, 0x02, 0x0E, 0x12, 0x0D, 0x03,
+  0x0F, 0x10, 0x0E, 0x04, 0x0F, 0x0E, 0x0E, 0x05, 0x10, 0x0B, 0x10, 0x06,
+  0x12, 0x05, 0x13, 0x06, 0x29, 0x08, 0x27, 0x0A, 0x25, 0x0C, 0x24, 0x0D,
+  0x22, 0x0F, 0x20, 0x11, 0x1D, 0x14, 0x1B, 0x17, 0x17, 0x1B, 0x14, 0x1E,
+  0x0F, 0x27, 0x03, 0x17, 0x15, 0x03, 0x27, 0x0F, 0x1D, 0x14, 0x19, 0x18,
+  0x16, 0x1B, 0x13, 0x1D, 0x10, 0x20, 0x0E, 0x22, 0x0C, 0x24, 0x0B, 0x25,
+  0x09, 0x27, 0x07, 0x28, 0x07, 0x12, 0x04, 0x13, 0x05, 0x10, 0x0A, 0x10,
+  0x05, 0x0F, 0x0D, 0x0F, 0x03, 0x0E, 0x10, 0x0E, 0x03, 0x0D, 0x12, 0x0E,
+  0x02, 0x0D, 0x13, 0x0D, 0x01, 0x0D, 0x15, 0x0C, 0x01, 0x0D, 0x15, 0x0C,
+  0x01, 0x0C, 0x16, 0x19, 0x17, 0x18, 0x17, 0x18, 0x17, 0x18, 0x17, 0x18,
+  0x17, 0x18, 0x17, 0x18, 0x16, 0x1A, 0x15, 0x0C, 0x01, 0x0D, 0x14, 0x0D,
+  0x02, 0x0D, 0x13, 0x0D, 0x02, 0x0E, 0x11, 0x0E, 0x02, 0x0F, 0x0F, 0x0E,
+  0x04, 0x0F, 0x0D, 0x0F, 0x04, 0x11, 0x09, 0x10, 0x06, 0x29, 0x06, 0x28,
+  0x08, 0x26, 0x0A, 0x25, 0x0B, 0x23, 0x0D, 0x21, 0x0F, 0x20, 0x10, 0x1E,
+  0x12, 0x1D, 0x14, 0x1A, 0x17, 0x17, 0x1B, 0x14, 0x20, 0x0E, 0x20, 0x0E,
+  0x21, 0x0E, 0x20, 0x0E, 0x20, 0x0E, 0x21, 0x0E, 0x20, 0x0E, 0x20, 0x0F,
+  0x20, 0x0E, 0x20, 0x0E, 0x21, 0x0E, 0x20, 0x0E, 0x20, 0x0E, 0x21, 0x0E,
+  0x20, 0x0E, 0x20, 0x0E, 0x21, 0x0E, 0x20, 0x0E, 0x20, 0x0F, 0x20, 0x0E,
+  0x20, 0x0E, 0x20, 0x0F, 0x20, 0x0E, 0x20, 0x0E, 0x21, 0x0D, 0x21, 0x0D,
+  0x21, 0x0C, 0x23, 0x0B, 0x23, 0x09, 0x27, 0x05, 0x25, 0x21, 0x0A, 0x23,
+  0x14, 0x1B, 0x19, 0x17, 0x1B, 0x15, 0x1D, 0x13, 0x1F, 0x11, 0x21, 0x10,
+  0x22, 0x0F, 0x23, 0x0D, 0x25, 0x0C, 0x26, 0x0B, 0x27, 0x0A, 0x18, 0x09,
+  0x07, 0x09, 0x15, 0x11, 0x03, 0x09, 0x12, 0x16, 0x01, 0x08, 0x11, 0x20,
+  0x11, 0x20, 0x11, 0x21, 0x0F, 0x22, 0x0F, 0x23, 0x0E, 0x23, 0x0E, 0x24,
+  0x0E, 0x23, 0x0E, 0x24, 0x0D, 0x24, 0x0E, 0x24, 0x0D, 0x25, 0x0D, 0x25,
+  0x0C, 0x25, 0x0D, 0x25, 0x0C, 0x26, 0x0C, 0x26, 0x0C, 0x26, 0x0C, 0x26,
+  0x0C, 0x25, 0x0C, 0x26, 0x0C, 0x26, 0x0C, 0x26, 0x0C, 0x26, 0x0C, 0x26,
+  0x0C, 0x26, 0x0C, 0x27, 0x0C, 0x26, 0x0C, 0x26, 0x0C, 0x26, 0x0C, 0x26,
+  0x0C, 0x26, 0x0D, 0x26, 0x0C, 0x26, 0x0D, 0x25, 0x0D, 0x26, 0x0D, 0x25,
+  0x0D, 0x25, 0x0E, 0x25, 0x0E, 0x24, 0x0F, 0x24, 0x0E, 0x24, 0x0F, 0x24,
+  0x10, 0x23, 0x10, 0x22, 0x11, 0x22, 0x12, 0x21, 0x13, 0x15, 0x01, 0x0A,
+  0x14, 0x10, 0x04, 0x0A, 0x19, 0x07, 0x08, 0x0B, 0x27, 0x0C, 0x26, 0x0E,
+  0x24, 0x0F, 0x23, 0x10, 0x22, 0x12, 0x20, 0x13, 0x1F, 0x15, 0x1D, 0x17,
+  0x1B, 0x1A, 0x18, 0x1D, 0x12, 0x27, 0x04, 0x0A };
+
+const PackedGlyph rodondo_digits_64pt_glyphs[] PROGMEM = {
+  {     0,  35,  12,  43,   4,  -43, GlyphEncoding::Runs },   // 0x2D '-'
+  {    25,   0,   0,   0,   0,    0, GlyphEncoding::Bits },   // not used
+  {    25,  38,  38,  38,   4,  -85, GlyphEncoding::Runs },   // 0x2F '/'
+  {   130,  52,  76,  60,   4,  -75, GlyphEncoding::Runs },   // 0x30 '0'
+  {   349,  12,  75,  20,   4,  -74, GlyphEncoding::Runs },   // 0x31 '1'
+  {   377,  47,  75,  55,   4,  -74, GlyphEncoding::Runs },   // 0x32 '2'
+  {   534,  45,  76,  53,   4,  -74, GlyphEncoding::Runs },   // 0x33 '3'
+  {   713,  60,  77,  68,   4,  -76, GlyphEncoding::Runs },   // 0x34 '4'
+  {   892,  49,  76,  57,   4,  -74, GlyphEncoding::Runs },   // 0x35 '5'
+  {  1081,  47,  77,  55,   4,  -75, GlyphEncoding::Runs },   // 0x36 '6'
+  {  1268,  49,  75,  57,   4,  -74, GlyphEncoding::Runs },   // 0x37 '7'
+  {  1419,  48,  76,  55,   4,  -74, GlyphEncoding::Runs },   // 0x38 '8'
+  {  1648,  47,  77,  55,   4,  -75, GlyphEncoding::Runs },   // 0x39 '9'
+  {  1833,  50,  77,  54,   1,  -75, GlyphEncoding::Runs } }; // 0x3A ':'
+
+const PackedFont rodondo_digits_64pt PROGMEM = {
+  rodondo_digits_64pt_bitmaps,
+  rodondo_digits_64pt_glyphs,
+  0x2D, 0x3A, 80 };
+
+// 13 glyphs, 2000 bytes of bitmaps, 5058 bytes bit-packed
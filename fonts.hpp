@@ -2,10 +2,37 @@
 #define RWCLOCK_FONTS_HPP_
 
 #include <cstdint>
-#include <gfxfont.h>
 
-extern const GFXfont rodondo_digits_64pt;
-extern const GFXfont rodondo_20pt;
-extern const GFXfont free_sans_20pt;
+// The fonts are generated by tools/font_subset from the Adafruit_GFX sources
+// in tools/fonts, with only the characters drawn. Large glyphs are stored as
+// run lengths, see the tool for the encoding.
+
+enum class GlyphEncoding : uint8_t {
+    Bits,   // bit-packed rows, like GFXglyph
+    Runs,   // run lengths of unset and set pixels
+};
+
+// Like GFXglyph, with the encoding of its bitmap
+struct PackedGlyph {
+    uint16_t bitmap_offset;
+    uint8_t width;
+    uint8_t height;
+    uint8_t x_advance;
+    int8_t x_offset;
+    int8_t y_offset;
+    GlyphEncoding encoding;
+};
+
+// Like GFXfont, in PROGMEM
+struct PackedFont {
+    const uint8_t* bitmaps;
+    const PackedGlyph* glyphs;
+    uint8_t first;
+    uint8_t last;
+    uint8_t y_advance;
+};
+
+extern const PackedFont rodondo_digits_64pt;    // "0123456789-/:"
+extern const PackedFont rodondo_20pt;           // all of it, the location can be any text
 
 #endif  // RWCLOCK_FONTS_HPP_
@@ -0,0 +1,58 @@
+#include "frame_diff.hpp"
+
+#include <algorithm>
+
+FrameHashes frame_hashes;
+
+static uint32_t rotateLeft(uint32_t value, int shift) {
+    return (value << shift) | (value >> (32 - shift));
+}
+
+// Two 32-bit multiply-rotate lanes with different seeds, the ESP8266 has
+// no 64-bit multiplier. Rows are read byte by byte, they aren't aligned.
+static uint64_t hashTile(const uint8_t* tile) {
+    uint32_t a = 0x9E3779B9u;
+    uint32_t b = 0x7F4A7C15u;
+    for (int y = 0; y < TILE_HEIGHT; ++y, tile += WIDTH / 8) {
+        const uint32_t word = (uint32_t)tile[0] << 24 | (uint32_t)tile[1] << 16
+                            | (uint32_t)tile[2] << 8 | tile[3];
+        a = rotateLeft(a ^ word, 13) * 0x85EBCA77u;
+        b = rotateLeft(b + word, 17) * 0xC2B2AE3Du;
+    }
+    return (uint64_t)(a ^ (b >> 15)) << 32 | (b ^ (a >> 13));
+}
+
+ScreenRect FrameHashes::update(int page) {
+    const uint8_t* display_buffer = getDisplayBuffer();
+    const bool was_valid = valid_pages_ & (1u << page);
+
+    int x0 = TILE_COLUMNS, y0 = PAGE_TILE_ROWS;
+    int x1 = 0, y1 = 0;
+
+    for (int row = 0; row < PAGE_TILE_ROWS; ++row) {
+        for (int column = 0; column < TILE_COLUMNS; ++column) {
+            const uint64_t hash = hashTile(display_buffer + row * TILE_HEIGHT * (WIDTH / 8)
+                                           + column * (TILE_WIDTH / 8));
+            uint64_t& shown = hashes_[page * PAGE_TILE_ROWS + row][column];
+            if (was_valid && hash == shown) {
+                continue;
+            }
+
+            shown = hash;
+            x0 = std::min(x0, column);
+            y0 = std::min(y0, row);
+            x1 = std::max(x1, column + 1);
+            y1 = std::max(y1, row + 1);
+        }
+    }
+
+    valid_pages_ |= 1u << page;
+
+    if (x0 >= x1) {
+        return ScreenRect{};
+    }
+    return ScreenRect{ (int16_t)(x0 * TILE_WIDTH),
+                       (int16_t)(page * PAGE_HEIGHT + y0 * TILE_HEIGHT),
+                       (int16_t)(x1 * TILE_WIDTH),
+                       (int16_t)(page * PAGE_HEIGHT + y1 * TILE_HEIGHT) };
+}
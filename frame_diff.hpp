@@ -0,0 +1,42 @@
+#ifndef RWCLOCK_FRAME_DIFF_HPP_
+#define RWCLOCK_FRAME_DIFF_HPP_
+
+#include <cstdint>
+
+#include "display.hpp"
+#include "display_list.hpp"
+
+constexpr int TILE_WIDTH = 32;      // one word of a row
+constexpr int TILE_HEIGHT = 40;     // tiles don't cross the pages
+constexpr int TILE_COLUMNS = WIDTH / TILE_WIDTH;
+constexpr int TILE_ROWS = HEIGHT / TILE_HEIGHT;
+constexpr int PAGE_TILE_ROWS = PAGE_HEIGHT / TILE_HEIGHT;
+
+static_assert(WIDTH % TILE_WIDTH == 0);
+static_assert(PAGE_HEIGHT % TILE_HEIGHT == 0);
+
+// A hash of every tile of the frame last sent to the panel, to find out
+// which parts of the next frame changed without keeping the frame itself
+class FrameHashes {
+  public:
+    // Hashes the tiles of the page rendered in the display buffer and keeps
+    // them, returns the bounds of the tiles that changed, empty if none.
+    // Everything changed when the hashes aren't valid.
+    ScreenRect update(int page);
+
+    // The panel shows something else now, like after a full refresh failed
+    void invalidate() { valid_pages_ = 0; }
+
+    // Whether all the pages were hashed since the last invalidate()
+    bool valid() const { return valid_pages_ == (1u << PAGE_COUNT) - 1; }
+
+    uint64_t tile(int row, int column) const { return hashes_[row][column]; }
+
+  private:
+    uint64_t hashes_[TILE_ROWS][TILE_COLUMNS] = {};
+    uint8_t valid_pages_ = 0;    // a bit per page
+};
+
+extern FrameHashes frame_hashes;
+
+#endif  // RWCLOCK_FRAME_DIFF_HPP_
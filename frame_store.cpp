@@ -0,0 +1,59 @@
+#include "frame_store.hpp"
+
+#include <Arduino.h>
+
+FrameStore frame_store;
+
+constexpr uint32_t FRAME_STAMP_MAGIC = 0x464C5752;    // "RWLF"
+constexpr int RTC_USER_MEMORY_SIZE = 512;
+
+// The stamp at the start of the RTC user memory, the tile hashes after it
+constexpr int TILE_HASHES_OFFSET = 12;
+constexpr int TILE_HASHES_SIZE = TILE_ROWS * TILE_COLUMNS;
+
+static_assert(TILE_HASHES_SIZE % 4 == 0, "RTC memory is written in words");
+static_assert(TILE_HASHES_OFFSET + TILE_HASHES_SIZE <= RTC_USER_MEMORY_SIZE);
+
+static uint8_t shortHash(uint64_t hash) {
+    hash ^= hash >> 32;
+    hash ^= hash >> 16;
+    hash ^= hash >> 8;
+    return (uint8_t)hash;
+}
+
+bool FrameStore::load() {
+    static_assert(sizeof(Stamp) == TILE_HASHES_OFFSET);
+    ESP.rtcUserMemoryRead(0, (uint32_t*)&stamp_, sizeof(stamp_));
+    if (stamp_.magic != FRAME_STAMP_MAGIC) {
+        // the power was lost, or it's the first boot
+        stamp_ = Stamp{ FRAME_STAMP_MAGIC, 0, 0 };
+        return false;
+    }
+
+    ESP.rtcUserMemoryRead(TILE_HASHES_OFFSET / 4, (uint32_t*)tile_hashes_, TILE_HASHES_SIZE);
+    loaded_ = stamp_.committed != 0;
+    return loaded_;
+}
+
+bool FrameStore::tileShown(int row, int column) const {
+    return loaded_ && tile_hashes_[row][column] == shortHash(frame_hashes.tile(row, column));
+}
+
+void FrameStore::beginFrame() {
+    ++stamp_.sequence;
+    stamp_.committed = 0;
+    ESP.rtcUserMemoryWrite(0, (uint32_t*)&stamp_, sizeof(stamp_));
+}
+
+void FrameStore::commitFrame() {
+    for (int row = 0; row < TILE_ROWS; ++row) {
+        for (int column = 0; column < TILE_COLUMNS; ++column) {
+            tile_hashes_[row][column] = shortHash(frame_hashes.tile(row, column));
+        }
+    }
+    ESP.rtcUserMemoryWrite(TILE_HASHES_OFFSET / 4, (uint32_t*)tile_hashes_, TILE_HASHES_SIZE);
+
+    stamp_.committed = 1;
+    ESP.rtcUserMemoryWrite(0, (uint32_t*)&stamp_, sizeof(stamp_));
+    loaded_ = false;
+}
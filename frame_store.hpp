@@ -0,0 +1,50 @@
+#ifndef RWCLOCK_FRAME_STORE_HPP_
+#define RWCLOCK_FRAME_STORE_HPP_
+
+#include <cstdint>
+
+#include "frame_diff.hpp"
+
+// What the panel shows is kept in the RTC memory, which survives resets and
+// deep sleep but not power loss: a byte of the hash of every tile and the
+// sequence number of the frame. After a reset the next frame is diffed
+// against it, so the first refresh can be a partial one.
+// The frame itself doesn't fit in the 512 bytes of RTC memory, and writing
+// it to LittleFS every minute would wear the flash. Instead the tiles that
+// don't match are given to the controller inverted as the previous frame,
+// so the partial refresh drives all of their pixels, whatever was shown.
+// With a byte per tile, 1 in 256 changed tiles looks unchanged and stays
+// stale until the next full refresh.
+class FrameStore {
+  public:
+    // Whether the RTC memory holds a frame that was completely refreshed.
+    // To be called at boot.
+    bool load();
+
+    bool loaded() const { return loaded_; }
+
+    // Whether the tile of frame_hashes matches the loaded frame
+    bool tileShown(int row, int column) const;
+
+    // The frame in frame_hashes is about to be refreshed, until commitFrame()
+    // the panel might show either frame
+    void beginFrame();
+
+    // The frame in frame_hashes was refreshed, the panel shows it now
+    void commitFrame();
+
+  private:
+    struct Stamp {
+        uint32_t magic;
+        uint32_t sequence;
+        uint32_t committed;     // 0 while the frame `sequence` is being refreshed
+    };
+
+    Stamp stamp_{};
+    uint8_t tile_hashes_[TILE_ROWS][TILE_COLUMNS] = {};
+    bool loaded_ = false;
+};
+
+extern FrameStore frame_store;
+
+#endif  // RWCLOCK_FRAME_STORE_HPP_
@@ -0,0 +1,201 @@
+#include "http_session.hpp"
+
+#include <ESP8266HTTPClient.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+int HttpSession::get(const char* host, uint16_t port, const char* path) {
+    if (!connect(host, port)) {
+        return HTTPC_ERROR_CONNECTION_FAILED;
+    }
+
+    client_.printf_P(PSTR("GET %s HTTP/1.1\r\n"
+                          "Host: %s\r\n"
+                          "User-Agent: RainWorldClock\r\n"
+                          "Connection: close\r\n"
+                          "\r\n"), path, host);
+
+    return readResponseHeaders();
+}
+
+bool HttpSession::connect(const char* host, uint16_t port) {
+    close();
+
+    const bool address_expired = millis() - address_resolved_at_ > ADDRESS_CACHE_MS;
+    if (!address_valid_ || address_expired || strcmp(host, host_) != 0) {
+        if (!WiFi.hostByName(host, address_)) {
+            Serial.printf_P(PSTR("[HTTP] Can't resolve: %s\n"), host);
+            address_valid_ = false;
+            return false;
+        }
+
+        strlcpy(host_, host, sizeof(host_));
+        address_resolved_at_ = millis();
+        address_valid_ = true;
+    }
+
+    client_.setTimeout(TIMEOUT_MS);
+    if (!client_.connect(address_, port)) {
+        Serial.printf_P(PSTR("[HTTP] Unable to connect: %s\n"), host);
+        // the server might have moved, resolve again next time
+        address_valid_ = false;
+        return false;
+    }
+
+    client_.setNoDelay(true);
+    return true;
+}
+
+void HttpSession::close() {
+    client_.stop();
+    body_done_ = true;
+}
+
+int HttpSession::timedRead() {
+    const unsigned long start = millis();
+    while (!client_.available()) {
+        if (!client_.connected() || millis() - start > TIMEOUT_MS) {
+            return -1;
+        }
+        delay(1);
+    }
+    return client_.read();
+}
+
+bool HttpSession::readLine(char* line, size_t size) {
+    size_t length = 0;
+    for (;;) {
+        const int c = timedRead();
+        if (c < 0) {
+            return false;
+        }
+        if (c == '\n') {
+            break;
+        }
+        // too long lines are truncated, none of the interesting ones is
+        if (c != '\r' && length + 1 < size) {
+            line[length++] = (char)c;
+        }
+    }
+
+    line[length] = '\0';
+    return true;
+}
+
+int HttpSession::readResponseHeaders() {
+    char line[128];
+    if (!readLine(line, sizeof(line))) {
+        return HTTPC_ERROR_READ_TIMEOUT;
+    }
+
+    int major = 0, minor = 0, code = 0;
+    if (sscanf(line, "HTTP/%d.%d %d", &major, &minor, &code) != 3) {
+        return HTTPC_ERROR_NO_HTTP_SERVER;
+    }
+
+    chunked_ = false;
+    remaining_ = -1;
+
+    for (;;) {
+        if (!readLine(line, sizeof(line))) {
+            return HTTPC_ERROR_READ_TIMEOUT;
+        }
+        if (line[0] == '\0') {
+            break;
+        }
+
+        char* value = strchr(line, ':');
+        if (value == nullptr) {
+            continue;
+        }
+        *value++ = '\0';
+        while (*value == ' ') ++value;
+
+        if (strcasecmp(line, "Content-Length") == 0) {
+            remaining_ = atol(value);
+        } else if (strcasecmp(line, "Transfer-Encoding") == 0) {
+            chunked_ = strcasecmp(value, "chunked") == 0;
+        }
+    }
+
+    // without Content-Length, the body ends with the connection
+    if (chunked_) {
+        remaining_ = 0;     // no chunk started yet
+    }
+
+    body_done_ = !chunked_ && remaining_ == 0;
+    return code;
+}
+
+bool HttpSession::startChunk() {
+    char line[32];
+    if (!readLine(line, sizeof(line))) {
+        return false;
+    }
+    // CRLF closing the data of the previous chunk
+    if (line[0] == '\0' && !readLine(line, sizeof(line))) {
+        return false;
+    }
+
+    remaining_ = strtol(line, nullptr, 16);
+    if (remaining_ > 0) {
+        return true;
+    }
+
+    // the last chunk, skip the trailer
+    while (readLine(line, sizeof(line)) && line[0] != '\0') { }
+    return false;
+}
+
+int HttpSession::read() {
+    if (body_done_) {
+        return -1;
+    }
+
+    if (chunked_ && remaining_ == 0 && !startChunk()) {
+        body_done_ = true;
+        return -1;
+    }
+
+    const int c = timedRead();
+    if (c < 0) {
+        body_done_ = true;
+        return -1;
+    }
+
+    if (remaining_ > 0 && --remaining_ == 0 && !chunked_) {
+        body_done_ = true;
+    }
+    return c;
+}
+
+size_t HttpSession::readBytes(char* buffer, size_t length) {
+    size_t total = 0;
+    while (total < length && !body_done_) {
+        if (chunked_ && remaining_ == 0 && !startChunk()) {
+            body_done_ = true;
+            break;
+        }
+
+        size_t wanted = length - total;
+        if (remaining_ > 0) {
+            wanted = std::min<size_t>(wanted, remaining_);
+        }
+
+        const size_t received = client_.readBytes(buffer + total, wanted);
+        if (received == 0) {
+            body_done_ = true;
+            break;
+        }
+
+        total += received;
+        if (remaining_ > 0) {
+            remaining_ -= received;
+            body_done_ = remaining_ == 0 && !chunked_;
+        }
+    }
+
+    return total;
+}
@@ -0,0 +1,52 @@
+#ifndef RWCLOCK_HTTP_SESSION_HPP_
+#define RWCLOCK_HTTP_SESSION_HPP_
+
+#include <ESP8266WiFi.h>
+
+// Minimal HTTP/1.1 GET client, remembering the resolved server address
+// between requests. There is a single endpoint, so each request uses its own
+// connection, closed by the server after the response.
+// The body is decoded on the fly (chunked or Content-Length), and the
+// session itself is a reader that can be passed to deserializeJson.
+class HttpSession {
+  public:
+    static constexpr unsigned long TIMEOUT_MS = 5000;
+    // A fixed hour, not the TTL of the record, which the Arduino resolver
+    // doesn't expose. The address is dropped earlier if connecting fails.
+    static constexpr unsigned long ADDRESS_CACHE_MS = 60UL * 60 * 1000;
+
+    HttpSession() = default;
+    HttpSession(const HttpSession&) = delete;
+    HttpSession& operator=(const HttpSession&) = delete;
+
+    // Sends the request and reads the response headers,
+    // returns the HTTP status code, or a negative value on error
+    int get(const char* host, uint16_t port, const char* path);
+
+    // Reader interface of the response body, as expected by ArduinoJson
+    int read();
+    size_t readBytes(char* buffer, size_t length);
+
+    // Ends the response, the rest of the body is dropped with the connection
+    void close();
+
+  private:
+    bool connect(const char* host, uint16_t port);
+    bool readLine(char* line, size_t size);
+    int readResponseHeaders();
+    bool startChunk();
+    int timedRead();
+
+    WiFiClient client_;
+    char host_[64] = "";
+
+    IPAddress address_;
+    unsigned long address_resolved_at_ = 0;
+    bool address_valid_ = false;
+
+    bool chunked_ = false;
+    bool body_done_ = true;
+    long remaining_ = 0;    // in the body or in the current chunk, -1 if unknown
+};
+
+#endif  // RWCLOCK_HTTP_SESSION_HPP_
@@ -0,0 +1,68 @@
+#include "memory_stats.hpp"
+#include "scratch_arena.hpp"
+
+#include <Arduino.h>
+#include <umm_malloc/umm_malloc.h>
+
+#include <algorithm>
+#include <iterator>
+
+static const char* const memory_user_names[] = {
+    "config", "special events", "WiFi", "day data", "drawing"
+};
+static_assert(std::size(memory_user_names) == (size_t)MemoryUser::COUNT);
+
+#if defined(UMM_STATS_FULL)
+// The allocator keeps the lowest free heap since the last reset
+static uint32_t lowestFreeHeap() { return umm_free_heap_size_lw_min(); }
+static void resetLowestFreeHeap() { umm_free_heap_size_min_reset(); }
+#else
+// The default build of the core doesn't track the lowest free heap, it's only
+// sampled when probes start and end, peaks in between are missed
+static uint32_t sampled_lowest_free = UINT32_MAX;
+
+static uint32_t lowestFreeHeap() {
+    sampled_lowest_free = std::min<uint32_t>(sampled_lowest_free, ESP.getFreeHeap());
+    return sampled_lowest_free;
+}
+static void resetLowestFreeHeap() { sampled_lowest_free = ESP.getFreeHeap(); }
+#endif
+
+static uint32_t peak_usage[(size_t)MemoryUser::COUNT] = {};
+static uint32_t lowest_free = UINT32_MAX;       // of all the probes
+static uint32_t nested_lowest = UINT32_MAX;     // of the probes inside the current one
+
+MemoryProbe::MemoryProbe(MemoryUser user)
+    : user_{user},
+      free_at_start_{ESP.getFreeHeap()},
+      outer_lowest_free_{lowestFreeHeap()},
+      outer_nested_lowest_{nested_lowest} {
+    resetLowestFreeHeap();
+    nested_lowest = UINT32_MAX;
+}
+
+MemoryProbe::~MemoryProbe() {
+    const uint32_t lowest = std::min(lowestFreeHeap(), nested_lowest);
+
+    uint32_t& peak = peak_usage[(size_t)user_];
+    if (free_at_start_ > lowest) {
+        peak = std::max(peak, free_at_start_ - lowest);
+    }
+    lowest_free = std::min(lowest_free, lowest);
+
+    // the allocator was reset by this probe, the outer one keeps its minimum here
+    nested_lowest = std::min({ outer_nested_lowest_, outer_lowest_free_, lowest });
+}
+
+void printMemoryReport() {
+    Serial.printf_P(PSTR("[MEM] Heap free: %u, largest block: %u, fragmentation: %u%%\n"),
+        ESP.getFreeHeap(), ESP.getMaxFreeBlockSize(), ESP.getHeapFragmentation());
+    Serial.printf_P(PSTR("[MEM] Lowest free heap: %u, stack never used: %u\n"),
+        std::min(lowest_free, lowestFreeHeap()), ESP.getFreeContStack());
+    Serial.printf_P(PSTR("[MEM] Scratch arena peak: %u/%u\n"),
+        (unsigned)scratch_arena.highWaterMark(), (unsigned)SCRATCH_ARENA_SIZE);
+
+    for (size_t i = 0; i < (size_t)MemoryUser::COUNT; ++i) {
+        Serial.printf_P(PSTR("[MEM] Peak heap of %s: %u\n"), memory_user_names[i], peak_usage[i]);
+    }
+}
@@ -0,0 +1,41 @@
+#ifndef RWCLOCK_MEMORY_STATS_HPP_
+#define RWCLOCK_MEMORY_STATS_HPP_
+
+#include <cstdint>
+
+// Parts of the clock whose heap usage is measured apart
+enum class MemoryUser : uint8_t {
+    Config,
+    SpecialEvents,
+    WiFi,
+    DayData,
+    Drawing,
+    COUNT
+};
+
+// Measures the most heap taken by a part of the clock while in scope, from
+// the lowest free heap seen by the allocator. Probes may nest, the heap taken
+// by the inner one counts towards the outer one too.
+// The peaks are exact when the core is built with -DUMM_STATS_FULL=1 in its
+// build flags, otherwise the free heap is only sampled when the probes start
+// and end.
+class MemoryProbe {
+  public:
+    explicit MemoryProbe(MemoryUser user);
+    ~MemoryProbe();
+
+    MemoryProbe(const MemoryProbe&) = delete;
+    MemoryProbe& operator=(const MemoryProbe&) = delete;
+
+  private:
+    MemoryUser user_;
+    uint32_t free_at_start_;
+    uint32_t outer_lowest_free_;    // seen by the outer probe before this one
+    uint32_t outer_nested_lowest_;
+};
+
+// Prints the free heap, its largest block, the stack never used, the peak
+// of the scratch arena and the peak heap usage of each part on Serial
+void printMemoryReport();
+
+#endif  // RWCLOCK_MEMORY_STATS_HPP_
@@ -1,12 +1,13 @@
 #include "bitmap_selector.hpp"
 #include "meteo.hpp"
 
+#include <array>
+#include <cstdint>
 #include <ctime>
+#include <iterator>
 
 MeteoData meteo_data;
 
-static const char* const weather_pictures_directory = "pictures_weather/";
-
 enum WeatherCode {
 	ClearSkies = 1000,
 	PartlyCloudy = 1003,
@@ -76,205 +77,235 @@ static int getMoonIllumination(time_t timestamp) {
     return get_percentage_of(illumination, SECONDS_EVERY_MOON / 2);
 }
 
-const char* getWeatherDayIconName(WeatherCode code) {
-    switch (code)
-    {
-    case ClearSkies:
-        return "0d_wi-day-sunny.bmp";
-	case PartlyCloudy:
-        return "1d_wi-day-cloudy.bmp";
-    case Cloudy:
-        return "2d_wi-cloud.bmp";
-	case Overcast:
-        return "3d_wi-cloudy.bmp";
-	case Mist:
-        return "wi-day-fog.bmp";
-	case PatchyRainPossible:
-        return "wi-day-rain.bmp";
-	case PatchySnowPossible:
-        return "wi-day-snow.bmp";
-	case PatchySleetPossible:
-	case PatchyFreezingDrizzlePossible:
-        return "wi-day-sleet.bmp";
-	case ThunderyOutbreaksPossible:
-        "wi-day-lightning.bmp";
-	case BlowingSnow:
-	case Blizzard:
-        "wi-snow-wind.bmp";
-	case Fog:
-	case FreezingFog:
-        return "wi-fog.bmp";
-	case PatchyLightDrizzle:
-	case LightDrizzle:
-        return "wi-day-sleet.bmp";
-	case FreezingDrizzle:
-	case HeavyFreezingDrizzle:
-        return "wi-sleet.bmp";
-    case PatchyLightRain:
-	case LightRain:
-        return "wi-day-showers.bmp";
-	case ModerateRainAtTimes:
-	case ModerateRain:
-        return "wi-day-rain.bmp";
-    case HeavyRainAtTimes:
-	case HeavyRain:
-        return "wi-rain.bmp";
-	case LightFreezingRain:
-	case ModerateOrHeavyFreezingRain:
-	case LightSleet:
-        return "wi-day-sleet.bmp";
-	case ModerateOrHeavySleet:
-        return "wi-sleet.bmp";
-    case PatchyLightSnow:
-	case LightSnow:
-	case PatchyModerateSnow:
-        return "wi-day-snow.bmp";
-	case ModerateSnow:
-	case PatchyHeavySnow:
-	case HeavySnow:
-        return "wi-snow.bmp";
-	case IcePellets:
-        return "wi-hail.bmp";
-	case LightRainShower:
-        return "wi-day-showers.bmp";
-	case ModerateOrHeavyRainShower:
-        return "wi-showers.bmp";
-	case TorrentialRainShower:
-        return "wi-showers.bmp";
-	case LightSleetShowers:
-        return "wi-day-sleet.bmp";
-	case ModerateOrHeavySleetShowers:
-        return "wi-sleet.bmp";
-	case LightSnowShowers:
-        return "wi-day-snow.bmp";
-	case ModerateOrHeavySnowShowers:
-        return "wi-snow.bmp";
-	case LightShowersOfIcePellets:
-        return "wi-day-hail.bmp";
-	case ModerateOrHeavyShowersOfIcePellets:
-        return "wi-hail.bmp";
-	case PatchyLightRainWithThunder:
-        return "wi-storm-showers.bmp";
-	case ModerateOrHeavyRainWithThunder:
-        return "wi-thunderstorm.bmp";
-	case PatchyLightSnowWithThunder:
-        return "wi-day-snow-thunderstorm.bmp";
-	case ModerateOrHeavySnowWithThunder:
-        return "wi-snow-thunderstorm.bmp";
-    default:
-        return "wi-na.bmp";
+// Numeric IDs of the icons in the pictures_weather directory
+enum class WeatherIcon : uint8_t {
+    DaySunny,
+    DayCloudy,
+    Cloud,
+    Cloudy,
+    DayFog,
+    DayHail,
+    DayLightning,
+    DayRain,
+    DayShowers,
+    DaySleet,
+    DaySnowThunderstorm,
+    DaySnow,
+    Fog,
+    Hail,
+    NotAvailable,
+    NightClear,
+    NightCloudy,
+    NightFog,
+    NightHail,
+    NightLightning,
+    NightRain,
+    NightShowers,
+    NightSleet,
+    NightSnowThunderstorm,
+    NightSnow,
+    Rain,
+    Showers,
+    Sleet,
+    SnowThunderstorm,
+    SnowWind,
+    Snow,
+    Stars,
+    StormShowers,
+    Thunderstorm,
+    COUNT
+};
+
+struct WeatherIconPath {
+    WeatherIcon icon;
+    char path[48];
+};
+
+static constexpr WeatherIconPath weather_icon_paths[] PROGMEM = {
+    { WeatherIcon::DaySunny,              "pictures_weather/0d_wi-day-sunny.bmp" },
+    { WeatherIcon::DayCloudy,             "pictures_weather/1d_wi-day-cloudy.bmp" },
+    { WeatherIcon::Cloud,                 "pictures_weather/2d_wi-cloud.bmp" },
+    { WeatherIcon::Cloudy,                "pictures_weather/3d_wi-cloudy.bmp" },
+    { WeatherIcon::DayFog,                "pictures_weather/wi-day-fog.bmp" },
+    { WeatherIcon::DayHail,               "pictures_weather/wi-day-hail.bmp" },
+    { WeatherIcon::DayLightning,          "pictures_weather/wi-day-lightning.bmp" },
+    { WeatherIcon::DayRain,               "pictures_weather/wi-day-rain.bmp" },
+    { WeatherIcon::DayShowers,            "pictures_weather/wi-day-showers.bmp" },
+    { WeatherIcon::DaySleet,              "pictures_weather/wi-day-sleet.bmp" },
+    { WeatherIcon::DaySnowThunderstorm,   "pictures_weather/wi-day-snow-thunderstorm.bmp" },
+    { WeatherIcon::DaySnow,               "pictures_weather/wi-day-snow.bmp" },
+    { WeatherIcon::Fog,                   "pictures_weather/wi-fog.bmp" },
+    { WeatherIcon::Hail,                  "pictures_weather/wi-hail.bmp" },
+    { WeatherIcon::NotAvailable,          "pictures_weather/wi-na.bmp" },
+    { WeatherIcon::NightClear,            "pictures_weather/wi-night-clear.bmp" },
+    { WeatherIcon::NightCloudy,           "pictures_weather/wi-night-cloudy.bmp" },
+    { WeatherIcon::NightFog,              "pictures_weather/wi-night-fog.bmp" },
+    { WeatherIcon::NightHail,             "pictures_weather/wi-night-hail.bmp" },
+    { WeatherIcon::NightLightning,        "pictures_weather/wi-night-lightning.bmp" },
+    { WeatherIcon::NightRain,             "pictures_weather/wi-night-rain.bmp" },
+    { WeatherIcon::NightShowers,          "pictures_weather/wi-night-showers.bmp" },
+    { WeatherIcon::NightSleet,            "pictures_weather/wi-night-sleet.bmp" },
+    { WeatherIcon::NightSnowThunderstorm, "pictures_weather/wi-night-snow-thunderstorm.bmp" },
+    { WeatherIcon::NightSnow,             "pictures_weather/wi-night-snow.bmp" },
+    { WeatherIcon::Rain,                  "pictures_weather/wi-rain.bmp" },
+    { WeatherIcon::Showers,               "pictures_weather/wi-showers.bmp" },
+    { WeatherIcon::Sleet,                 "pictures_weather/wi-sleet.bmp" },
+    { WeatherIcon::SnowThunderstorm,      "pictures_weather/wi-snow-thunderstorm.bmp" },
+    { WeatherIcon::SnowWind,              "pictures_weather/wi-snow-wind.bmp" },
+    { WeatherIcon::Snow,                  "pictures_weather/wi-snow.bmp" },
+    { WeatherIcon::Stars,                 "pictures_weather/wi-stars.bmp" },
+    { WeatherIcon::StormShowers,          "pictures_weather/wi-storm-showers.bmp" },
+    { WeatherIcon::Thunderstorm,          "pictures_weather/wi-thunderstorm.bmp" },
+};
+
+enum SkyState {
+    Day,
+    NightMoon,
+    NightNoMoon,
+    SKY_STATE_COUNT
+};
+
+struct WeatherIcons {
+    WeatherCode code;
+    WeatherIcon icons[SKY_STATE_COUNT];
+};
+
+// Sorted by code, every code of the WeatherCode enum has to be here
+static constexpr WeatherIcons weather_icons_by_code[] = {
+    { ClearSkies,                         { WeatherIcon::DaySunny,            WeatherIcon::NightClear,            WeatherIcon::Stars } },
+    { PartlyCloudy,                       { WeatherIcon::DayCloudy,           WeatherIcon::NightCloudy,           WeatherIcon::NightCloudy } },
+    { Cloudy,                             { WeatherIcon::Cloud,               WeatherIcon::Cloud,                 WeatherIcon::Cloud } },
+    { Overcast,                           { WeatherIcon::Cloudy,              WeatherIcon::Cloudy,                WeatherIcon::Cloudy } },
+    { Mist,                               { WeatherIcon::DayFog,              WeatherIcon::NightFog,              WeatherIcon::NightFog } },
+    { PatchyRainPossible,                 { WeatherIcon::DayRain,             WeatherIcon::NightRain,             WeatherIcon::NightRain } },
+    { PatchySnowPossible,                 { WeatherIcon::DaySnow,             WeatherIcon::NightSnow,             WeatherIcon::NightSnow } },
+    { PatchySleetPossible,                { WeatherIcon::DaySleet,            WeatherIcon::NightSleet,            WeatherIcon::NightSleet } },
+    { PatchyFreezingDrizzlePossible,      { WeatherIcon::DaySleet,            WeatherIcon::NightSleet,            WeatherIcon::NightSleet } },
+    { ThunderyOutbreaksPossible,          { WeatherIcon::DayLightning,        WeatherIcon::NightLightning,        WeatherIcon::NightLightning } },
+    { BlowingSnow,                        { WeatherIcon::SnowWind,            WeatherIcon::SnowWind,              WeatherIcon::SnowWind } },
+    { Blizzard,                           { WeatherIcon::SnowWind,            WeatherIcon::SnowWind,              WeatherIcon::SnowWind } },
+    { Fog,                                { WeatherIcon::Fog,                 WeatherIcon::Fog,                   WeatherIcon::Fog } },
+    { FreezingFog,                        { WeatherIcon::Fog,                 WeatherIcon::Fog,                   WeatherIcon::Fog } },
+    { PatchyLightDrizzle,                 { WeatherIcon::DaySleet,            WeatherIcon::NightSleet,            WeatherIcon::NightSleet } },
+    { LightDrizzle,                       { WeatherIcon::DaySleet,            WeatherIcon::NightSleet,            WeatherIcon::NightSleet } },
+    { FreezingDrizzle,                    { WeatherIcon::Sleet,               WeatherIcon::Sleet,                 WeatherIcon::Sleet } },
+    { HeavyFreezingDrizzle,               { WeatherIcon::Sleet,               WeatherIcon::Sleet,                 WeatherIcon::Sleet } },
+    { PatchyLightRain,                    { WeatherIcon::DayShowers,          WeatherIcon::NightShowers,          WeatherIcon::NightShowers } },
+    { LightRain,                          { WeatherIcon::DayShowers,          WeatherIcon::NightShowers,          WeatherIcon::NightShowers } },
+    { ModerateRainAtTimes,                { WeatherIcon::DayRain,             WeatherIcon::NightRain,             WeatherIcon::NightRain } },
+    { ModerateRain,                       { WeatherIcon::DayRain,             WeatherIcon::NightRain,             WeatherIcon::NightRain } },
+    { HeavyRainAtTimes,                   { WeatherIcon::Rain,                WeatherIcon::Rain,                  WeatherIcon::Rain } },
+    { HeavyRain,                          { WeatherIcon::Rain,                WeatherIcon::Rain,                  WeatherIcon::Rain } },
+    { LightFreezingRain,                  { WeatherIcon::DaySleet,            WeatherIcon::NightSleet,            WeatherIcon::NightSleet } },
+    { ModerateOrHeavyFreezingRain,        { WeatherIcon::DaySleet,            WeatherIcon::NightSleet,            WeatherIcon::NightSleet } },
+    { LightSleet,                         { WeatherIcon::DaySleet,            WeatherIcon::NightSleet,            WeatherIcon::NightSleet } },
+    { ModerateOrHeavySleet,               { WeatherIcon::Sleet,               WeatherIcon::Sleet,                 WeatherIcon::Sleet } },
+    { PatchyLightSnow,                    { WeatherIcon::DaySnow,             WeatherIcon::NightSnow,             WeatherIcon::NightSnow } },
+    { LightSnow,                          { WeatherIcon::DaySnow,             WeatherIcon::NightSnow,             WeatherIcon::NightSnow } },
+    { PatchyModerateSnow,                 { WeatherIcon::DaySnow,             WeatherIcon::NightSnow,             WeatherIcon::NightSnow } },
+    { ModerateSnow,                       { WeatherIcon::Snow,                WeatherIcon::Snow,                  WeatherIcon::Snow } },
+    { PatchyHeavySnow,                    { WeatherIcon::Snow,                WeatherIcon::Snow,                  WeatherIcon::Snow } },
+    { HeavySnow,                          { WeatherIcon::Snow,                WeatherIcon::Snow,                  WeatherIcon::Snow } },
+    { IcePellets,                         { WeatherIcon::Hail,                WeatherIcon::Hail,                  WeatherIcon::Hail } },
+    { LightRainShower,                    { WeatherIcon::DayShowers,          WeatherIcon::NightShowers,          WeatherIcon::NightShowers } },
+    { ModerateOrHeavyRainShower,          { WeatherIcon::Showers,             WeatherIcon::Showers,               WeatherIcon::Showers } },
+    { TorrentialRainShower,               { WeatherIcon::Showers,             WeatherIcon::Showers,               WeatherIcon::Showers } },
+    { LightSleetShowers,                  { WeatherIcon::DaySleet,            WeatherIcon::NightSleet,            WeatherIcon::NightSleet } },
+    { ModerateOrHeavySleetShowers,        { WeatherIcon::Sleet,               WeatherIcon::Sleet,                 WeatherIcon::Sleet } },
+    { LightSnowShowers,                   { WeatherIcon::DaySnow,             WeatherIcon::NightSnow,             WeatherIcon::NightSnow } },
+    { ModerateOrHeavySnowShowers,         { WeatherIcon::Snow,                WeatherIcon::Snow,                  WeatherIcon::Snow } },
+    { LightShowersOfIcePellets,           { WeatherIcon::DayHail,             WeatherIcon::NightHail,             WeatherIcon::NightHail } },
+    { ModerateOrHeavyShowersOfIcePellets, { WeatherIcon::Hail,                WeatherIcon::Hail,                  WeatherIcon::Hail } },
+    { PatchyLightRainWithThunder,         { WeatherIcon::StormShowers,        WeatherIcon::StormShowers,          WeatherIcon::StormShowers } },
+    { ModerateOrHeavyRainWithThunder,     { WeatherIcon::Thunderstorm,        WeatherIcon::Thunderstorm,          WeatherIcon::Thunderstorm } },
+    { PatchyLightSnowWithThunder,         { WeatherIcon::DaySnowThunderstorm, WeatherIcon::NightSnowThunderstorm, WeatherIcon::NightSnowThunderstorm } },
+    { ModerateOrHeavySnowWithThunder,     { WeatherIcon::SnowThunderstorm,    WeatherIcon::SnowThunderstorm,      WeatherIcon::SnowThunderstorm } },
+};
+
+// All the codes are 1000 + 3k, so (code - 1000) / 3 indexes a dense table
+static constexpr int WEATHER_CODE_FIRST = ClearSkies;
+static constexpr int WEATHER_CODE_STEP = 3;
+static constexpr int WEATHER_CODE_SLOTS =
+    (ModerateOrHeavySnowWithThunder - WEATHER_CODE_FIRST) / WEATHER_CODE_STEP + 1;
+
+constexpr bool validateWeatherIconTables() {
+    for (int i = 0; i < (int)WeatherIcon::COUNT; ++i) {
+        if (weather_icon_paths[i].icon != (WeatherIcon)i) return false;
+    }
+
+    for (size_t i = 0; i < std::size(weather_icons_by_code); ++i) {
+        const WeatherIcons& entry = weather_icons_by_code[i];
+        if ((entry.code - WEATHER_CODE_FIRST) % WEATHER_CODE_STEP != 0) return false;
+        if (i > 0 && weather_icons_by_code[i - 1].code >= entry.code) return false;
+    }
+    return true;
+}
+
+static_assert(std::size(weather_icon_paths) == (size_t)WeatherIcon::COUNT,
+              "Every weather icon needs a file");
+static_assert(std::size(weather_icons_by_code) == 48,
+              "Every WeatherCode needs its icons");
+static_assert(validateWeatherIconTables(),
+              "Weather icon tables need to be sorted and match the icon IDs");
+
+using WeatherIconTable = std::array<std::array<WeatherIcon, WEATHER_CODE_SLOTS>, SKY_STATE_COUNT>;
+
+static constexpr WeatherIconTable makeWeatherIconTable() {
+    WeatherIconTable table{};
+    for (auto& state_icons : table) {
+        for (auto& icon : state_icons) {
+            icon = WeatherIcon::NotAvailable;
+        }
     }
+
+    for (const WeatherIcons& entry : weather_icons_by_code) {
+        const int slot = (entry.code - WEATHER_CODE_FIRST) / WEATHER_CODE_STEP;
+        for (int state = 0; state < SKY_STATE_COUNT; ++state) {
+            table[state][slot] = entry.icons[state];
+        }
+    }
+    return table;
 }
 
-const char* getWeatherNightIconName(WeatherCode code, bool moon_visible) {
-    switch (code)
-    {
-    case ClearSkies:
-        return moon_visible ? "wi-night-clear.bmp" : "wi-stars.bmp";
-	case PartlyCloudy:
-        return "wi-night-cloudy.bmp";
-    case Cloudy:
-        return "2d_wi-cloud.bmp";
-	case Overcast:
-        return "3d_wi-cloudy.bmp";
-	case Mist:
-        return "wi-night-fog.bmp";
-	case PatchyRainPossible:
-        return "wi-night-rain.bmp";
-	case PatchySnowPossible:
-        return "wi-night-snow.bmp";
-	case PatchySleetPossible:
-	case PatchyFreezingDrizzlePossible:
-        return "wi-night-sleet.bmp";
-	case ThunderyOutbreaksPossible:
-        "wi-night-lightning.bmp";
-	case BlowingSnow:
-	case Blizzard:
-        "wi-snow-wind.bmp";
-	case Fog:
-	case FreezingFog:
-        return "wi-fog.bmp";
-	case PatchyLightDrizzle:
-	case LightDrizzle:
-        return "wi-night-sleet.bmp";
-	case FreezingDrizzle:
-	case HeavyFreezingDrizzle:
-        return "wi-sleet.bmp";
-    case PatchyLightRain:
-	case LightRain:
-        return "wi-night-showers.bmp";
-	case ModerateRainAtTimes:
-	case ModerateRain:
-        return "wi-night-rain.bmp";
-    case HeavyRainAtTimes:
-	case HeavyRain:
-        return "wi-rain.bmp";
-	case LightFreezingRain:
-	case ModerateOrHeavyFreezingRain:
-	case LightSleet:
-        return "wi-night-sleet.bmp";
-	case ModerateOrHeavySleet:
-        return "wi-sleet.bmp";
-    case PatchyLightSnow:
-	case LightSnow:
-	case PatchyModerateSnow:
-        return "wi-night-snow.bmp";
-	case ModerateSnow:
-	case PatchyHeavySnow:
-	case HeavySnow:
-        return "wi-snow.bmp";
-	case IcePellets:
-        return "wi-hail.bmp";
-	case LightRainShower:
-        return "wi-night-showers.bmp";
-	case ModerateOrHeavyRainShower:
-        return "wi-showers.bmp";
-	case TorrentialRainShower:
-        return "wi-showers.bmp";
-	case LightSleetShowers:
-        return "wi-night-sleet.bmp";
-	case ModerateOrHeavySleetShowers:
-        return "wi-sleet.bmp";
-	case LightSnowShowers:
-        return "wi-night-snow.bmp";
-	case ModerateOrHeavySnowShowers:
-        return "wi-snow.bmp";
-	case LightShowersOfIcePellets:
-        return "wi-night-hail.bmp";
-	case ModerateOrHeavyShowersOfIcePellets:
-        return "wi-hail.bmp";
-	case PatchyLightRainWithThunder:
-        return "wi-storm-showers.bmp";
-	case ModerateOrHeavyRainWithThunder:
-        return "wi-thunderstorm.bmp";
-	case PatchyLightSnowWithThunder:
-        return "wi-night-snow-thunderstorm.bmp";
-	case ModerateOrHeavySnowWithThunder:
-        return "wi-snow-thunderstorm.bmp";
-    default:
-        return "wi-na.bmp";
+static constexpr WeatherIconTable weather_icon_table PROGMEM = makeWeatherIconTable();
+
+static WeatherIcon getWeatherIconId(int code, SkyState state) {
+    const int offset = code - WEATHER_CODE_FIRST;
+    if (offset < 0 || offset % WEATHER_CODE_STEP != 0
+        || offset / WEATHER_CODE_STEP >= WEATHER_CODE_SLOTS) {
+        return WeatherIcon::NotAvailable;
     }
+
+    return (WeatherIcon)pgm_read_byte(&weather_icon_table[state][offset / WEATHER_CODE_STEP]);
 }
 
-std::optional<BitmapFile> getWeatherIcon() {
-	bool is_day = meteo_data.is_day;
-	bool moon_visible = getMoonIllumination(meteo_data.timestamp) > 20;
+static std::optional<BitmapFile> loadWeatherIcon(WeatherIcon icon) {
+    // LittleFS needs the path in RAM
+    char path_buffer[sizeof(WeatherIconPath::path)];
+    strcpy_P(path_buffer, weather_icon_paths[(int)icon].path);
 
-	WeatherCode code = (WeatherCode)meteo_data.weather_now;
+    return loadBitmap(path_buffer);
+}
 
-	const char* const bmp_name = is_day
-		? getWeatherDayIconName(code)
-		: getWeatherNightIconName(code, moon_visible);
+// Memoized icon, the file stays open as long as the icon is the same
+struct CachedWeatherIcon {
+    std::optional<BitmapFile> bitmap;
+    WeatherIcon icon = WeatherIcon::COUNT;
+};
 
-	if (bmp_name == nullptr) {
-		Serial.printf("Can't find the icon for code %d\n", (int)code);
-		return std::nullopt;
-	}
+static CachedWeatherIcon weather_icon_cache;
 
-	char path_buffer[64];
+BitmapFile* getWeatherIcon() {
+    const bool moon_visible = getMoonIllumination(meteo_data.timestamp) > 20;
+    const SkyState state = meteo_data.is_day ? Day : (moon_visible ? NightMoon : NightNoMoon);
+    const WeatherIcon icon = getWeatherIconId(meteo_data.weather_now, state);
 
-	strcpy(path_buffer, weather_pictures_directory);
-	strlcat(path_buffer, bmp_name, sizeof(path_buffer));
+    CachedWeatherIcon& cache = weather_icon_cache;
+    if (cache.icon != icon || !cache.bitmap) {
+        cache.bitmap.reset();   // close the previous file first
+        cache.bitmap = loadWeatherIcon(icon);
+        cache.icon = icon;
+    }
 
-	return loadBitmap(path_buffer);
+    return cache.bitmap ? &*cache.bitmap : nullptr;
 }
@@ -30,6 +30,7 @@ struct MeteoData {
 
 extern MeteoData meteo_data;
 
-std::optional<BitmapFile> getWeatherIcon();
+// Reopened only when the icon choice changes, i.e. after a meteo update
+BitmapFile* getWeatherIcon();
 
 #endif  // RWCLOCK_METEO_HPP_
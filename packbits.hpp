@@ -0,0 +1,78 @@
+#ifndef RWCLOCK_PACKBITS_HPP_
+#define RWCLOCK_PACKBITS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// PackBits run-length coding, of the gray pictures and their converter.
+// A header byte n in [0, 127] is followed by n + 1 literal bytes, n in
+// [-127, -1] by one byte repeated 1 - n times, -128 is a no-op.
+// No Arduino dependencies, so the tools share it with the clock.
+
+// Packs `size` bytes, `out` needs room for 2 * size bytes at worst.
+// Returns the bytes written.
+inline size_t packBits(const uint8_t* input, size_t size, uint8_t* out) {
+    size_t written = 0;
+    size_t i = 0;
+    while (i < size) {
+        size_t run = 1;
+        while (i + run < size && run < 128 && input[i + run] == input[i]) {
+            ++run;
+        }
+
+        if (run >= 2) {
+            out[written++] = (uint8_t)(1 - (int)run);
+            out[written++] = input[i];
+            i += run;
+            continue;
+        }
+
+        // a literal ends before the next run
+        size_t literal_end = i + 1;
+        while (literal_end < size && literal_end - i < 128
+               && !(literal_end + 1 < size && input[literal_end] == input[literal_end + 1])) {
+            ++literal_end;
+        }
+
+        out[written++] = (uint8_t)(literal_end - i - 1);
+        memcpy(out + written, input + i, literal_end - i);
+        written += literal_end - i;
+        i = literal_end;
+    }
+    return written;
+}
+
+// Unpacks `size` bytes, the packed ones come from read_byte(), which returns
+// -1 at their end, and go to write_byte(index, value). False if the packed
+// bytes end first.
+template <typename ReadByte, typename WriteByte>
+bool unpackBits(ReadByte&& read_byte, WriteByte&& write_byte, size_t size) {
+    size_t length = 0;
+    while (length < size) {
+        const int header = read_byte();
+        if (header < 0) {
+            return false;
+        }
+
+        const int n = (int8_t)header;
+        if (n == -128) {
+            continue;
+        }
+
+        const int count = n >= 0 ? n + 1 : 1 - n;
+        int value = n >= 0 ? 0 : read_byte();
+        for (int i = 0; i < count && length < size; ++i) {
+            if (n >= 0) {
+                value = read_byte();
+            }
+            if (value < 0) {
+                return false;
+            }
+            write_byte(length++, (uint8_t)value);
+        }
+    }
+    return true;
+}
+
+#endif  // RWCLOCK_PACKBITS_HPP_
@@ -10,6 +10,11 @@
 #include "date_utils.hpp"
 #include "display.hpp"
 #include "drawing.hpp"
+#include "frame_store.hpp"
+#include "memory_stats.hpp"
+#include "special_events.hpp"
+#include "text_renderer.hpp"
+#include "timezone_rules.hpp"
 
 #include <ctime>
 #include <LittleFS.h>
@@ -26,15 +31,52 @@ void delayUntilNextMinute() {
   delay(1000 * s + ms);
 }
 
+// Applies config.json and the special events uploaded while running,
+// returns true if the palette changed and the screen has to be redrawn whole
+bool reloadChangedFiles(struct tm& now_local) {
+  const DisplayMode mode_before = getCurrentDisplayMode(now_local);
+
+  const ConfigChanges changes = reloadConfigIfChanged();
+  if (changes.wifi) {
+    reconnectToWiFi();
+  }
+  if (changes.timezone) {
+    setTimezone(config.timezone);
+  }
+  // the automatic timezone comes with the day data
+  if (changes.location || (changes.timezone && !config.manual_timezone)) {
+    invalidateServerQuery();
+    updateLocalDataFromServer();
+  }
+
+  const bool special_events_changed = reloadSpecialEventsIfChanged();
+  if (changes.schedule || changes.display_modes || special_events_changed) {
+    invalidateBackgroundImage();
+  }
+
+  if (!changes.any()) {
+    return false;
+  }
+  toLocalTime(time(nullptr), now_local);
+  return getCurrentDisplayMode(now_local) != mode_before;
+}
+
 void setup() {
+  // E-ink keeps its image over a reset, when the last frame sent is known
+  // the controller isn't cleared and the first refresh can be a partial one
+  const bool frame_known = frame_store.load();
+
   // serial is initialized by display init, do NOT init it here explicitly
-  display.init(115200, true, 2, false);
+  display.init(115200, !frame_known, 2, false);
   display.setRotation(0);
   delay(1000);   // for serial initialization
 
   Serial.println();
   Serial.println(F("Rain World Clock startup..."));
 
+  // Expands the temperature glyphs, so they don't have to be decoded every minute
+  initGlyphCaches();
+
   if (!LittleFS.begin()) {
     // TODO error
     return;
@@ -43,8 +85,13 @@ void setup() {
   // Reads WiFi settings, information about location/timezone if provided
   readConfig();
 
+  // Parses the timezone rules once, local time doesn't depend on the server
+  setTimezone(config.timezone);
+
   // Reads for what days/nights should there be a special background
-  readSpecialBitmapsConfig();
+  if (!readSpecialBitmapsConfig()) {
+    Serial.println(F("Some special events were not loaded"));
+  }
 
   // Connects to WiFi, keeps the connection on
   connectToWiFi();
@@ -64,24 +111,25 @@ void setup() {
   if (!waitForNTPUpdate()) {
     // TODO: error on timeout of NTA
   }
+
+  printMemoryReport();
 }
 
 void loop() {
   time_t now = time(nullptr);
   struct tm now_local {};
-  localtime_r(&now, &now_local);
+  toLocalTime(now, now_local);
 
-  if (now_local.tm_min % 15 == 0) {
-    // Full update on every quarter or time update from NTP
-    display.setFullWindow();
-  } else {
-    display.setPartialWindow(0, 0, display.width(), display.height());
-  }
+  const bool palette_changed = reloadChangedFiles(now_local);
 
-  drawDisplay(now_local);
+  // Full update on every quarter, or when light and dark swap
+  const bool full_refresh = now_local.tm_min % 15 == 0 || palette_changed;
+  drawDisplay(now_local, full_refresh);
 
   if ((now_local.tm_min + 1) % 30 == 0) {
     updateLocalDataFromServer();
+
+    printMemoryReport();
   }
 
   delayUntilNextMinute();
@@ -0,0 +1,309 @@
+#include "raster_ops.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__,
+              "The words are byte-swapped to keep the leftmost pixel in the MSB");
+
+namespace {
+
+// The pixel order in the buffer is big-endian, so the words are swapped
+// on load and store. Then shifting a word moves pixels left or right.
+inline uint32_t loadWord(const uint32_t* p) {
+    return __builtin_bswap32(*p);
+}
+
+inline void storeWord(uint32_t* p, uint32_t value) {
+    *p = __builtin_bswap32(value);
+}
+
+// Row pointers are aligned down to words, the difference goes into the bit offset
+inline int misalignment(const uint8_t* row) {
+    return (int)((uintptr_t)row & 3);
+}
+
+// Destination words holding the pixels [x, x + width) of a row.
+// Only these words are touched, with the pixels outside of the range masked.
+struct DstSpan {
+    uint32_t* words;
+    int row_begin;  // bit offsets from `words`
+    int begin;
+    int first_word;
+    int last_word;
+    uint32_t first_mask;
+    uint32_t last_mask;
+
+    DstSpan(uint8_t* row, int x, int width) {
+        const int offset = misalignment(row);
+        words = (uint32_t*)(row - offset);
+        row_begin = offset * 8;
+        begin = x + row_begin;
+        const int end = begin + width;
+        first_word = begin / 32;
+        last_word = (end - 1) / 32;
+        first_mask = 0xFFFFFFFFu >> (begin % 32);
+        last_mask = end % 32 ? ~(0xFFFFFFFFu >> (end % 32)) : 0xFFFFFFFFu;
+        if (first_word == last_word) {
+            first_mask &= last_mask;
+        }
+    }
+};
+
+// Reads source pixels as words aligned with the destination words,
+// merging two consecutive source words with a funnel shift
+class SourceReader {
+  public:
+    SourceReader(const uint8_t* row, int x, int width, const DstSpan& dst) {
+        const int offset = misalignment(row);
+        words_ = (const uint32_t*)(row - offset);
+        const int begin = x + offset * 8;
+        last_word_ = (begin + width - 1) / 32;
+
+        // Source pixel landing on the first pixel of the first destination
+        // word, might be before the row, such pixels are masked out anyway
+        const int start = begin - dst.begin % 32;
+        shift_ = start & 31;
+        index_ = start >> 5;    // floor, also for negative values
+        current_ = fetch(index_);
+    }
+
+    // The edge words may need source words outside of the row, these are checked
+    template <bool checked>
+    uint32_t next() {
+        ++index_;
+        const uint32_t following = checked ? fetch(index_) : loadWord(words_ + index_);
+        const uint32_t value = shift_
+            ? (current_ << shift_) | (following >> (32 - shift_))
+            : current_;
+        current_ = following;
+        return value;
+    }
+
+  private:
+    uint32_t fetch(int index) const {
+        return index >= 0 && index <= last_word_ ? loadWord(words_ + index) : 0;
+    }
+
+    const uint32_t* words_;
+    int last_word_;
+    int index_;
+    int shift_;
+    uint32_t current_;
+};
+
+// Reads a repeating pattern as words aligned with the destination words
+class PatternReader {
+  public:
+    PatternReader(const RowPattern& pattern, const DstSpan& dst) : pattern_{pattern} {
+        // pixel of the row on the first bit of the first destination word,
+        // negative if the row starts in the middle of that word
+        const int period = 32 * pattern.length;
+        const int start = ((dst.first_word * 32 - dst.row_begin) % period + period) % period;
+        shift_ = start % 32;
+        index_ = start / 32;
+    }
+
+    template <bool>
+    uint32_t next() {
+        const int following = index_ + 1 == pattern_.length ? 0 : index_ + 1;
+        const uint32_t value = shift_
+            ? (pattern_.words[index_] << shift_) | (pattern_.words[following] >> (32 - shift_))
+            : pattern_.words[index_];
+        index_ = following;
+        return value;
+    }
+
+  private:
+    const RowPattern& pattern_;
+    int index_;
+    int shift_;
+};
+
+// Patterns of a single word are the same word on each position, only rotated
+class ConstantReader {
+  public:
+    ConstantReader(const RowPattern& pattern, const DstSpan& dst) {
+        const int shift = ((dst.first_word * 32 - dst.row_begin) % 32 + 32) % 32;
+        value_ = shift ? (pattern.words[0] << shift) | (pattern.words[0] >> (32 - shift))
+                       : pattern.words[0];
+    }
+
+    template <bool>
+    uint32_t next() const {
+        return value_;
+    }
+
+  private:
+    uint32_t value_;
+};
+
+template <BlitMode mode>
+inline uint32_t combine(uint32_t dst, uint32_t src) {
+    if constexpr (mode == BlitMode::And) {
+        return dst & src;
+    } else if constexpr (mode == BlitMode::Or) {
+        return dst | src;
+    } else if constexpr (mode == BlitMode::OrNot) {
+        return dst | ~src;
+    } else if constexpr (mode == BlitMode::AndNot) {
+        return dst & ~src;
+    } else if constexpr (mode == BlitMode::Xor) {
+        return dst ^ src;
+    } else if constexpr (mode == BlitMode::Copy) {
+        return src;
+    } else {
+        return ~src;
+    }
+}
+
+template <BlitMode mode>
+inline void blendWord(uint32_t* dst, uint32_t src, uint32_t mask) {
+    const uint32_t value = loadWord(dst);
+    storeWord(dst, (value & ~mask) | (combine<mode>(value, src) & mask));
+}
+
+template <BlitMode mode, typename Reader>
+void applyRow(const DstSpan& dst, Reader& source) {
+    blendWord<mode>(dst.words + dst.first_word, source.template next<true>(), dst.first_mask);
+    if (dst.first_word == dst.last_word) {
+        return;
+    }
+
+    for (int i = dst.first_word + 1; i < dst.last_word; ++i) {
+        storeWord(dst.words + i, combine<mode>(loadWord(dst.words + i), source.template next<false>()));
+    }
+
+    blendWord<mode>(dst.words + dst.last_word, source.template next<true>(), dst.last_mask);
+}
+
+template <BlitMode mode>
+void applyRowMasked(const DstSpan& dst, SourceReader& source, SourceReader& mask) {
+    for (int i = dst.first_word; i <= dst.last_word; ++i) {
+        uint32_t word_mask = 0xFFFFFFFFu;
+        if (i == dst.first_word) word_mask &= dst.first_mask;
+        if (i == dst.last_word) word_mask &= dst.last_mask;
+
+        // the edge words are always read with bounds checks
+        const bool edge = i == dst.first_word || i == dst.last_word;
+        const uint32_t src_word = edge ? source.next<true>() : source.next<false>();
+        const uint32_t mask_word = edge ? mask.next<true>() : mask.next<false>();
+
+        blendWord<mode>(dst.words + i, src_word, word_mask & mask_word);
+    }
+}
+
+// Calls f with the mode as a compile time constant, so every mode gets its own loop
+template <typename F>
+void dispatch(BlitMode mode, F&& f) {
+    using M = BlitMode;
+    switch (mode) {
+    case M::And:     f(std::integral_constant<M, M::And>{});     break;
+    case M::Or:      f(std::integral_constant<M, M::Or>{});      break;
+    case M::OrNot:   f(std::integral_constant<M, M::OrNot>{});   break;
+    case M::AndNot:  f(std::integral_constant<M, M::AndNot>{});  break;
+    case M::Xor:     f(std::integral_constant<M, M::Xor>{});     break;
+    case M::Copy:    f(std::integral_constant<M, M::Copy>{});    break;
+    case M::CopyNot: f(std::integral_constant<M, M::CopyNot>{}); break;
+    }
+}
+
+constexpr uint8_t BAYER_4X4[4][4] = {
+    {  0,  8,  2, 10 },
+    { 12,  4, 14,  6 },
+    {  3, 11,  1,  9 },
+    { 15,  7, 13,  5 },
+};
+
+// Level 1 of 3 is 5 white pixels of 16, level 2 is 11 of 16
+struct GrayPatternRows {
+    uint32_t level1[4];
+    uint32_t level2[4];
+};
+
+constexpr GrayPatternRows makeGrayPatternRows() {
+    GrayPatternRows rows{};
+    for (int y = 0; y < 4; ++y) {
+        for (int x = 0; x < 32; ++x) {
+            const uint32_t bit = 0x80000000u >> x;
+            if (BAYER_4X4[y][x % 4] < 5)  rows.level1[y] |= bit;
+            if (BAYER_4X4[y][x % 4] < 11) rows.level2[y] |= bit;
+        }
+    }
+    return rows;
+}
+
+constexpr GrayPatternRows gray_pattern_rows = makeGrayPatternRows();
+
+inline uint32_t rotateLeft(uint32_t value, int shift) {
+    return shift ? (value << shift) | (value >> (32 - shift)) : value;
+}
+
+}  // namespace
+
+void blitRow(uint8_t* dst_row, int dst_x,
+             const uint8_t* src_row, int src_x,
+             int width, BlitMode mode) {
+    if (width <= 0 || dst_x < 0 || src_x < 0) {
+        return;
+    }
+
+    const DstSpan dst(dst_row, dst_x, width);
+    SourceReader source(src_row, src_x, width, dst);
+    dispatch(mode, [&](auto m) { applyRow<m()>(dst, source); });
+}
+
+void blitRowMasked(uint8_t* dst_row, int dst_x,
+                   const uint8_t* src_row, const uint8_t* mask_row, int src_x,
+                   int width, BlitMode mode) {
+    if (width <= 0 || dst_x < 0 || src_x < 0) {
+        return;
+    }
+
+    const DstSpan dst(dst_row, dst_x, width);
+    SourceReader source(src_row, src_x, width, dst);
+    SourceReader mask(mask_row, src_x, width, dst);
+    dispatch(mode, [&](auto m) { applyRowMasked<m()>(dst, source, mask); });
+}
+
+void fillRow(uint8_t* row, int x, int width, const RowPattern& pattern, BlitMode mode) {
+    if (width <= 0 || x < 0) {
+        return;
+    }
+
+    const DstSpan dst(row, x, width);
+    if (pattern.length == 1) {
+        ConstantReader source(pattern, dst);
+        dispatch(mode, [&](auto m) { applyRow<m()>(dst, source); });
+    } else {
+        PatternReader source(pattern, dst);
+        dispatch(mode, [&](auto m) { applyRow<m()>(dst, source); });
+    }
+}
+
+void fillRect(uint8_t* buffer, int stride, int x, int y, int width, int height,
+              const RowPattern& pattern, BlitMode mode) {
+    for (int row = y; row < y + height; ++row) {
+        fillRow(buffer + row * stride, x, width, pattern, mode);
+    }
+}
+
+void ditherGrayRow(uint8_t* dst_row, const uint8_t* high_plane, const uint8_t* low_plane,
+                   int width, int x, int y, bool invert) {
+    // the patterns repeat every 4 pixels, so all words start at the same phase
+    const int phase = (x % 4 + 4) % 4;
+    const uint32_t level1 = rotateLeft(gray_pattern_rows.level1[(y % 4 + 4) % 4], phase);
+    const uint32_t level2 = rotateLeft(gray_pattern_rows.level2[(y % 4 + 4) % 4], phase);
+    const uint32_t flip = invert ? 0xFFFFFFFFu : 0;
+
+    uint32_t* dst = (uint32_t*)dst_row;
+    const uint32_t* high = (const uint32_t*)high_plane;
+    const uint32_t* low = (const uint32_t*)low_plane;
+
+    for (int i = 0; i < (width + 31) / 32; ++i) {
+        const uint32_t h = loadWord(high + i) ^ flip;
+        const uint32_t l = loadWord(low + i) ^ flip;
+        // 3 is white, 2 the denser pattern, 1 the sparser one, 0 black
+        storeWord(dst + i, (h & (l | level2)) | (~h & l & level1));
+    }
+}
@@ -0,0 +1,63 @@
+#ifndef RWCLOCK_RASTER_OPS_HPP_
+#define RWCLOCK_RASTER_OPS_HPP_
+
+#include <cstdint>
+
+// 1bpp raster kernels working on the page buffer layout of GxEPD2:
+// rows of bytes, the most significant bit is the leftmost pixel, 1 is white.
+// They work on aligned 32-bit words, which cost the same as bytes on Xtensa.
+// No Arduino dependencies, so they can be built and measured on the host.
+
+enum class BlitMode : uint8_t {
+    And,    // dst &= src, black pixels of the source on a white background
+    Or,     // dst |= src, white pixels of the source on a black background
+    OrNot,  // dst |= ~src, black pixels of the source as white ones
+    AndNot, // dst &= ~src, white pixels of the source as black ones
+    Xor,    // dst ^= src
+    Copy,   // dst = src
+    CopyNot // dst = ~src
+};
+
+// Pixel pattern repeating along a row every 32 * length pixels,
+// the leftmost pixel of words[0] lies on x == 0 of the row
+struct RowPattern {
+    uint32_t words[3];
+    uint8_t length;
+};
+
+constexpr RowPattern solidPattern(bool white) {
+    return RowPattern{ { white ? 0xFFFFFFFFu : 0u }, 1 };
+}
+
+constexpr RowPattern repeatedBytePattern(uint8_t byte) {
+    return RowPattern{ { byte * 0x01010101u }, 1 };
+}
+
+// Combines `width` pixels of the source row, starting at pixel src_x, into the
+// destination row starting at pixel dst_x. Any x offsets and widths are fine,
+// and the rows don't need to be aligned, pixels outside the range are kept.
+void blitRow(uint8_t* dst_row, int dst_x,
+             const uint8_t* src_row, int src_x,
+             int width, BlitMode mode);
+
+// Same as blitRow, but only the pixels set in the mask row are changed.
+// The mask has the same layout and x offset as the source.
+void blitRowMasked(uint8_t* dst_row, int dst_x,
+                   const uint8_t* src_row, const uint8_t* mask_row, int src_x,
+                   int width, BlitMode mode);
+
+void fillRow(uint8_t* row, int x, int width, const RowPattern& pattern, BlitMode mode);
+
+// Rectangle in a buffer of `stride` bytes per row, the pattern is the same on each row
+void fillRect(uint8_t* buffer, int stride, int x, int y, int width, int height,
+              const RowPattern& pattern, BlitMode mode);
+
+// Expands a row of a 2bpp gray picture, given as the planes of the high and
+// the low bits of the levels, to 1bpp with a 4x4 Bayer matrix. The matrix is
+// aligned to the screen: x and y are the screen position of the row's first
+// pixel, so the patterns don't move between partial refreshes.
+// Inverted, level 0 becomes white. All rows are 4-byte aligned and padded to words.
+void ditherGrayRow(uint8_t* dst_row, const uint8_t* high_plane, const uint8_t* low_plane,
+                   int width, int x, int y, bool invert);
+
+#endif  // RWCLOCK_RASTER_OPS_HPP_
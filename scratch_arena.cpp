@@ -0,0 +1,46 @@
+#include "scratch_arena.hpp"
+
+#include <Arduino.h>
+
+ScratchArena scratch_arena;
+
+static size_t alignUp(size_t size) {
+    return (size + 7) & ~(size_t)7;
+}
+
+uint8_t* ScratchArena::take(size_t size) {
+    if (alignUp(size) > available()) {
+        Serial.printf_P(PSTR("Scratch arena full, %u bytes wanted, %u left\n"),
+            (unsigned)size, (unsigned)available());
+        return nullptr;
+    }
+
+    uint8_t* block = memory_ + top_;
+    top_ += alignUp(size);
+    updateHighWaterMark(top_);
+    return block;
+}
+
+uint8_t* ScratchArena::takeRest(size_t& size) {
+    size = available();
+    uint8_t* block = memory_ + top_;
+    top_ = SCRATCH_ARENA_SIZE;
+    return block;
+}
+
+void ScratchArena::giveBack(uint8_t* block) {
+    top_ = block - memory_;
+}
+
+void ScratchArena::recordUsage(const uint8_t* block, size_t used) {
+    updateHighWaterMark(block - memory_ + used);
+}
+
+void ScratchArena::updateHighWaterMark(size_t used) {
+    if (used <= high_water_mark_) {
+        return;
+    }
+    high_water_mark_ = used;
+    Serial.printf_P(PSTR("Scratch arena peak: %u/%u bytes\n"),
+        (unsigned)used, (unsigned)SCRATCH_ARENA_SIZE);
+}
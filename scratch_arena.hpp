@@ -0,0 +1,68 @@
+#ifndef RWCLOCK_SCRATCH_ARENA_HPP_
+#define RWCLOCK_SCRATCH_ARENA_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+// Memory for parsing and I/O staging, apart from the display buffer, so
+// reading a file or a response doesn't wipe the page being rendered.
+// Blocks are taken and given back in stack order. The most memory used at
+// once is reported on Serial when it grows, to size the arena from real usage.
+// The biggest document is a special events file at the limits of the loader,
+// 48 rules with range keys and 1 KiB of names: 48 * 3 slots of 16 bytes,
+// 576 bytes of keys and the names, about 3.9 KiB. Computed with the slot
+// size of ArduinoJson 6, not measured. The shipped files take under 0.7 KiB.
+// A document that doesn't fit is reported by printJsonError().
+constexpr size_t SCRATCH_ARENA_SIZE = 6 * 1024;
+
+class ScratchArena {
+  public:
+    // A block of `size` bytes, aligned to 8, nullptr if it doesn't fit
+    uint8_t* take(size_t size);
+
+    // All that is left, the caller reports the part used with recordUsage()
+    uint8_t* takeRest(size_t& size);
+
+    // Gives back the block, and all the blocks taken after it
+    void giveBack(uint8_t* block);
+
+    // Only `used` bytes of the block were needed
+    void recordUsage(const uint8_t* block, size_t used);
+
+    size_t available() const { return SCRATCH_ARENA_SIZE - top_; }
+    size_t highWaterMark() const { return high_water_mark_; }
+
+  private:
+    void updateHighWaterMark(size_t used);
+
+    size_t top_ = 0;
+    size_t high_water_mark_ = 0;
+    alignas(8) uint8_t memory_[SCRATCH_ARENA_SIZE] = {};
+};
+
+extern ScratchArena scratch_arena;
+
+// A block of the arena for one scope. Without a size, it takes all that
+// is left, e.g. for a JSON document.
+class ScratchBlock {
+  public:
+    ScratchBlock() { data_ = scratch_arena.takeRest(size_); }
+    explicit ScratchBlock(size_t size)
+        : data_{scratch_arena.take(size)}, size_{data_ ? size : 0} {}
+    ~ScratchBlock() { if (data_) scratch_arena.giveBack(data_); }
+
+    ScratchBlock(const ScratchBlock&) = delete;
+    ScratchBlock& operator=(const ScratchBlock&) = delete;
+
+    uint8_t* data() const { return data_; }
+    size_t size() const { return size_; }
+    explicit operator bool() const { return data_ != nullptr; }
+
+    void recordUsage(size_t used) { if (data_) scratch_arena.recordUsage(data_, used); }
+
+  private:
+    uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+#endif  // RWCLOCK_SCRATCH_ARENA_HPP_
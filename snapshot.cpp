@@ -0,0 +1,120 @@
+#include "snapshot.hpp"
+#include "scratch_arena.hpp"
+
+#include <coredecls.h>
+#include <cstring>
+#include <LittleFS.h>
+
+struct SnapshotHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t source_count;
+    SourceStamp sources[MAX_SNAPSHOT_SOURCES];  // only source_count of them in the file
+};
+
+SourceStamp stampOf(const char* path) {
+    File f = LittleFS.open(path, "r");
+    if (!f) {
+        return SourceStamp{ UINT32_MAX, 0 };
+    }
+    return SourceStamp{ (uint32_t)f.size(), (uint32_t)f.getLastWrite() };
+}
+
+// The header as it would be written now, returns its size in the file
+static size_t currentHeader(SnapshotHeader& header, uint16_t version,
+                            const char* const* sources, int source_count) {
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = version;
+    header.source_count = (uint16_t)source_count;
+    for (int i = 0; i < source_count; ++i) {
+        header.sources[i] = stampOf(sources[i]);
+    }
+    return offsetof(SnapshotHeader, sources) + source_count * sizeof(SourceStamp);
+}
+
+static uint32_t stateSize(const SnapshotChunk* chunks, int chunk_count) {
+    uint32_t size = 0;
+    for (int i = 0; i < chunk_count; ++i) {
+        size += chunks[i].size;
+    }
+    return size;
+}
+
+bool loadSnapshot(const char* path, uint16_t version,
+                  const char* const* sources, int source_count,
+                  const SnapshotChunk* chunks, int chunk_count) {
+    if (source_count > MAX_SNAPSHOT_SOURCES) {
+        return false;
+    }
+
+    SnapshotHeader header;
+    const size_t header_size = currentHeader(header, version, sources, source_count);
+    const uint32_t state_size = stateSize(chunks, chunk_count);
+    const size_t file_size = header_size + 4 + state_size + 4;
+
+    File f = LittleFS.open(path, "r");
+    if (!f || f.size() != file_size) {
+        return false;
+    }
+
+    ScratchBlock block(file_size);
+    if (!block) {
+        return false;
+    }
+    uint8_t* data = block.data();
+    const size_t read = f.readBytes((char*)data, file_size);
+    f.close();
+
+    uint32_t stored_state_size = 0;
+    uint32_t stored_crc = 0;
+    memcpy(&stored_state_size, data + header_size, 4);
+    memcpy(&stored_crc, data + file_size - 4, 4);
+
+    if (read != file_size || memcmp(data, &header, header_size) != 0
+        || stored_state_size != state_size || crc32(data, file_size - 4) != stored_crc) {
+        return false;
+    }
+
+    const uint8_t* state = data + header_size + 4;
+    for (int i = 0; i < chunk_count; ++i) {
+        memcpy(chunks[i].data, state, chunks[i].size);
+        state += chunks[i].size;
+    }
+    return true;
+}
+
+bool saveSnapshot(const char* path, uint16_t version,
+                  const char* const* sources, int source_count,
+                  const SnapshotChunk* chunks, int chunk_count) {
+    if (source_count > MAX_SNAPSHOT_SOURCES) {
+        return false;
+    }
+
+    SnapshotHeader header;
+    const size_t header_size = currentHeader(header, version, sources, source_count);
+    const uint32_t state_size = stateSize(chunks, chunk_count);
+
+    File f = LittleFS.open(path, "w");
+    if (!f) {
+        return false;
+    }
+
+    uint32_t crc = crc32(&header, header_size);
+    crc = crc32(&state_size, 4, crc);
+    bool written = f.write((const uint8_t*)&header, header_size) == header_size
+                   && f.write((const uint8_t*)&state_size, 4) == 4;
+
+    for (int i = 0; i < chunk_count && written; ++i) {
+        crc = crc32(chunks[i].data, chunks[i].size, crc);
+        written = f.write((const uint8_t*)chunks[i].data, chunks[i].size) == chunks[i].size;
+    }
+    written = written && f.write((const uint8_t*)&crc, 4) == 4;
+    f.close();
+
+    if (!written) {
+        LittleFS.remove(path);
+        Serial.printf_P(PSTR("Can't write snapshot: %s\n"), path);
+    }
+    return written;
+}
@@ -0,0 +1,47 @@
+#ifndef RWCLOCK_SNAPSHOT_HPP_
+#define RWCLOCK_SNAPSHOT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+// Binary snapshots of state parsed from JSON files, to skip parsing at boot.
+// A snapshot is valid while its source files keep their sizes and modification
+// times, and only for the same version and layout of the state.
+//
+// File: SNAPSHOT_MAGIC, version (uint16_t), number of sources (uint16_t),
+// size and modification time of each source (uint32_t each), size of the
+// state (uint32_t), the state, then CRC-32 of everything before it.
+constexpr char SNAPSHOT_MAGIC[4] = { 'R', 'W', 'S', 'N' };
+constexpr int MAX_SNAPSHOT_SOURCES = 2;
+
+// Identifies a version of a source file, without reading it
+struct SourceStamp {
+    uint32_t size;          // UINT32_MAX if the file is missing
+    uint32_t last_write;
+
+    bool operator==(const SourceStamp& other) const {
+        return size == other.size && last_write == other.last_write;
+    }
+    bool operator!=(const SourceStamp& other) const { return !(*this == other); }
+};
+
+SourceStamp stampOf(const char* path);
+
+// A piece of the state, copied as it is
+struct SnapshotChunk {
+    void* data;
+    size_t size;
+};
+
+// Fills the chunks from the snapshot in one read, false if it's missing,
+// broken or out of date. The chunks are left untouched then.
+bool loadSnapshot(const char* path, uint16_t version,
+                  const char* const* sources, int source_count,
+                  const SnapshotChunk* chunks, int chunk_count);
+
+// Writes the chunks with the current stamps of the sources
+bool saveSnapshot(const char* path, uint16_t version,
+                  const char* const* sources, int source_count,
+                  const SnapshotChunk* chunks, int chunk_count);
+
+#endif  // RWCLOCK_SNAPSHOT_HPP_
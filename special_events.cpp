@@ -0,0 +1,477 @@
+#include "special_events.hpp"
+#include "bufref_json.hpp"
+#include "memory_stats.hpp"
+#include "snapshot.hpp"
+
+#include <ArduinoJson.h>
+#include <LittleFS.h>
+#include <cstdio>
+#include <iterator>
+
+struct SpecialPicture {
+    AssetId light;
+    AssetId dark;
+};
+
+struct SpecialEventRule {
+    // In the order of compilation, later kinds overwrite earlier ones
+    enum Kind : uint8_t {
+        DateRange,
+        WeekdayOnDay,
+        NthWeekday,
+        Easter,
+        FixedDate,
+        KIND_COUNT
+    };
+
+    Kind kind;
+    bool is_night;
+    uint8_t picture;        // index + 1 into special_pictures
+    uint8_t month;          // FixedDate, DateRange start, NthWeekday
+    uint8_t day;            // FixedDate, DateRange start, WeekdayOnDay
+    uint8_t end_month;      // DateRange
+    uint8_t end_day;        // DateRange
+    uint8_t weekday;        // NthWeekday, WeekdayOnDay, 0 == Sunday
+    uint8_t week;           // NthWeekday, 5 == the last one
+    short offset;           // Easter
+};
+
+struct SpecialEventTable {
+    // 0 if there is no event that day, otherwise index of the picture + 1
+    uint8_t picture_by_day[DAY_OF_YEAR_SLOTS];
+};
+
+static char names_pool[SPECIAL_NAMES_POOL_SIZE];
+static int names_pool_position = 0;
+
+// asset_name_offsets[id - 1] is the offset of the name in the pool
+static uint16_t asset_name_offsets[MAX_SPECIAL_ASSETS];
+static int asset_count = 0;
+
+static SpecialPicture special_pictures[MAX_SPECIAL_PICTURES];
+static int special_picture_count = 0;
+
+static SpecialEventRule special_rules[MAX_SPECIAL_RULES];
+static int special_rule_count = 0;
+
+static SpecialEventTable special_days;
+static SpecialEventTable special_nights;
+static int compiled_year = 0;   // 0 if the tables need to be compiled
+
+static bool rules_complete = false;    // all the events were loaded, worth a snapshot
+
+static constexpr char SPECIAL_DAYS_PATH[] = "special_days.json";
+static constexpr char SPECIAL_NIGHTS_PATH[] = "special_nights.json";
+static constexpr char SPECIAL_EVENTS_SNAPSHOT_PATH[] = "special_events.bin";
+static constexpr uint16_t SPECIAL_EVENTS_SNAPSHOT_VERSION = 2;
+
+static const char* const special_events_sources[] = { SPECIAL_DAYS_PATH, SPECIAL_NIGHTS_PATH };
+static SourceStamp special_events_stamps[2] = {};     // of the files read last
+
+// The parsed rules with their names, and the tables compiled for compiled_year
+static const SnapshotChunk special_events_chunks[] = {
+    { names_pool, sizeof(names_pool) },
+    { &names_pool_position, sizeof(names_pool_position) },
+    { asset_name_offsets, sizeof(asset_name_offsets) },
+    { &asset_count, sizeof(asset_count) },
+    { special_pictures, sizeof(special_pictures) },
+    { &special_picture_count, sizeof(special_picture_count) },
+    { special_rules, sizeof(special_rules) },
+    { &special_rule_count, sizeof(special_rule_count) },
+    { &special_days, sizeof(special_days) },
+    { &special_nights, sizeof(special_nights) },
+    { &compiled_year, sizeof(compiled_year) },
+};
+
+static bool loadSpecialEventsSnapshot() {
+    return loadSnapshot(SPECIAL_EVENTS_SNAPSHOT_PATH, SPECIAL_EVENTS_SNAPSHOT_VERSION,
+                        special_events_sources, 2,
+                        special_events_chunks, std::size(special_events_chunks));
+}
+
+static void saveSpecialEventsSnapshot() {
+    saveSnapshot(SPECIAL_EVENTS_SNAPSHOT_PATH, SPECIAL_EVENTS_SNAPSHOT_VERSION,
+                 special_events_sources, 2,
+                 special_events_chunks, std::size(special_events_chunks));
+}
+
+static_assert(MAX_SPECIAL_ASSETS < 256 && MAX_SPECIAL_PICTURES < 256);
+static_assert(SPECIAL_NAMES_POOL_SIZE <= UINT16_MAX);
+
+const char* getSpecialAssetName(AssetId id) {
+    if (id == NO_ASSET || id > asset_count) {
+        return nullptr;
+    }
+    return names_pool + asset_name_offsets[id - 1];
+}
+
+static AssetId internAssetName(const char* name) {
+    if (name == nullptr) {
+        return NO_ASSET;
+    }
+
+    // the same picture is often used by many events, e.g. both day and night
+    for (AssetId id = 1; id <= asset_count; ++id) {
+        if (strcmp(getSpecialAssetName(id), name) == 0) {
+            return id;
+        }
+    }
+
+    const int len = strlen(name);
+    if (len >= LFS_NAME_MAX) {
+        Serial.printf_P(PSTR("Special picture name too long: %s\n"), name);
+        return NO_ASSET;
+    }
+
+    if (asset_count >= MAX_SPECIAL_ASSETS
+        || names_pool_position + len + 1 > SPECIAL_NAMES_POOL_SIZE) {
+        Serial.printf_P(PSTR("Too many special pictures, dropped: %s\n"), name);
+        return NO_ASSET;
+    }
+
+    memcpy(names_pool + names_pool_position, name, len + 1);
+    asset_name_offsets[asset_count++] = names_pool_position;
+    names_pool_position += len + 1;
+
+    return asset_count;
+}
+
+// Returns the value to be put in the day table, 0 if the picture can't be added
+static uint8_t addSpecialPicture(AssetId light, AssetId dark) {
+    for (int i = 0; i < special_picture_count; ++i) {
+        if (special_pictures[i].light == light && special_pictures[i].dark == dark) {
+            return i + 1;
+        }
+    }
+
+    if (special_picture_count >= MAX_SPECIAL_PICTURES) {
+        Serial.printf_P(PSTR("Too many special pictures, event dropped\n"));
+        return 0;
+    }
+
+    special_pictures[special_picture_count++] = SpecialPicture{ .light = light, .dark = dark };
+    return special_picture_count;
+}
+
+static int parseWeekday(const char* name) {
+    static const char* const weekdays[] = { "sun", "mon", "tue", "wed", "thu", "fri", "sat" };
+    for (int i = 0; i < 7; ++i) {
+        if (strcasecmp(name, weekdays[i]) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int parseWeekOrdinal(const char* name) {
+    static const char* const ordinals[] = { "1st", "2nd", "3rd", "4th", "5th" };
+    for (int i = 0; i < 5; ++i) {
+        if (strcasecmp(name, ordinals[i]) == 0) {
+            return i + 1;
+        }
+    }
+    return strcasecmp(name, "last") == 0 ? 5 : -1;
+}
+
+static constexpr uint8_t DAYS_IN_MONTH[] = { 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+// February 29th is valid, it's there only in leap years
+static bool isValidDate(int day, int month) {
+    return month >= 1 && month <= 12 && day >= 1 && day <= DAYS_IN_MONTH[month - 1];
+}
+
+static bool parseEventRule(const char* key, SpecialEventRule& rule) {
+    int day = 0, month = 0, end_day = 0, end_month = 0, consumed = 0;
+    char first_word[8] = "", second_word[4] = "";
+
+    if (strncasecmp(key, "easter", 6) == 0) {
+        char* end = nullptr;
+        const long offset = strtol(key + 6, &end, 10);
+        if (*end != '\0' || offset < -366 || offset > 366) return false;
+
+        rule.kind = SpecialEventRule::Easter;
+        rule.offset = (short)offset;
+        return true;
+    }
+
+    if (sscanf(key, "%2d/%2d%n", &day, &month, &consumed) == 2) {
+        if (!isValidDate(day, month)) return false;
+        rule.day = day;
+        rule.month = month;
+
+        const char* rest = key + consumed;
+        if (*rest == '-') {
+            // a range, nothing may follow its end
+            consumed = 0;
+            if (sscanf(rest, "-%2d/%2d%n", &end_day, &end_month, &consumed) != 2
+                || rest[consumed] != '\0' || !isValidDate(end_day, end_month)) {
+                return false;
+            }
+
+            rule.kind = SpecialEventRule::DateRange;
+            rule.end_day = end_day;
+            rule.end_month = end_month;
+            return true;
+        }
+
+        // trailing text is accepted, as it always was for fixed dates
+        rule.kind = SpecialEventRule::FixedDate;
+        return true;
+    }
+
+    if (sscanf(key, "%7s %3[a-zA-Z]/%2d%n", first_word, second_word, &month, &consumed) == 3
+        && key[consumed] == '\0') {
+        const int week = parseWeekOrdinal(first_word);
+        const int weekday = parseWeekday(second_word);
+        if (week < 0 || weekday < 0 || month < 1 || month > 12) return false;
+
+        rule.kind = SpecialEventRule::NthWeekday;
+        rule.week = week;
+        rule.weekday = weekday;
+        rule.month = month;
+        return true;
+    }
+
+    if (sscanf(key, "%3[a-zA-Z] %2d%n", first_word, &day, &consumed) == 2
+        && key[consumed] == '\0') {
+        const int weekday = parseWeekday(first_word);
+        if (weekday < 0 || day < 1 || day > 31) return false;
+
+        rule.kind = SpecialEventRule::WeekdayOnDay;
+        rule.weekday = weekday;
+        rule.day = day;
+        return true;
+    }
+
+    return false;
+}
+
+static bool readSpecialBitmapsFile(const char* file, bool is_night) {
+    File special_events_file = LittleFS.open(file, "r");
+
+    if (!special_events_file) {
+        Serial.printf_P(PSTR("Can't open special bitmaps file\n"));
+        return false;
+    }
+
+    ScratchJsonDocument doc;
+    DeserializationError error = deserializeJson(doc, special_events_file);
+    special_events_file.close();
+
+    if (error) {
+        printJsonError(file, error);
+        return false;
+    }
+
+    bool all_loaded = true;
+    const JsonObjectConst event_map = doc.as<JsonObjectConst>();
+
+    for (const auto& event : event_map) {
+        SpecialEventRule rule{};
+        if (!parseEventRule(event.key().c_str(), rule)) {
+            // Either parsing failed or a non-logical value
+            Serial.printf_P(PSTR("Can't parse event date: %s\n"), event.key().c_str());
+            continue;
+        }
+
+        if (special_rule_count >= MAX_SPECIAL_RULES) {
+            Serial.printf_P(PSTR("Too many special events, dropped: %s\n"), event.key().c_str());
+            all_loaded = false;
+            continue;
+        }
+
+        const char* light = event.value()["light"].as<const char*>();
+        const char* dark = event.value()["dark"].as<const char*>();
+        const AssetId light_id = internAssetName(light);
+        const AssetId dark_id = internAssetName(dark);
+        all_loaded &= (light_id != NO_ASSET || !light) && (dark_id != NO_ASSET || !dark);
+
+        rule.is_night = is_night;
+        rule.picture = addSpecialPicture(light_id, dark_id);
+        if (rule.picture == 0) {
+            all_loaded = false;
+            continue;
+        }
+
+        special_rules[special_rule_count++] = rule;
+
+        Serial.printf_P(PSTR("Loaded special event: %s: (%s, %s)\n"),
+            event.key().c_str(),
+            getSpecialAssetName(light_id) ?: "",
+            getSpecialAssetName(dark_id) ?: "");
+    }
+
+    return all_loaded;
+}
+
+bool readSpecialBitmapsConfig() {
+    MemoryProbe probe(MemoryUser::SpecialEvents);
+
+    for (int i = 0; i < 2; ++i) {
+        special_events_stamps[i] = stampOf(special_events_sources[i]);
+    }
+
+    if (loadSpecialEventsSnapshot()) {
+        rules_complete = true;
+        Serial.printf_P(PSTR("Special events loaded from snapshot: %d rules, compiled for year %d\n"),
+            special_rule_count, compiled_year);
+        return true;
+    }
+
+    names_pool_position = 0;
+    asset_count = 0;
+    special_picture_count = 0;
+    special_rule_count = 0;
+    compiled_year = 0;
+
+    bool days_loaded = readSpecialBitmapsFile(SPECIAL_DAYS_PATH, false);
+    bool nights_loaded = readSpecialBitmapsFile(SPECIAL_NIGHTS_PATH, true);
+
+    Serial.printf_P(PSTR("Special events: %d rules, %d pictures, %d names, %d/%d bytes of names\n"),
+        special_rule_count, special_picture_count, asset_count,
+        names_pool_position, SPECIAL_NAMES_POOL_SIZE);
+
+    // the tables are compiled later, for the current year, and kept with the rules then
+    rules_complete = days_loaded && nights_loaded;
+    return rules_complete;
+}
+
+bool reloadSpecialEventsIfChanged() {
+    if (stampOf(SPECIAL_DAYS_PATH) == special_events_stamps[0]
+        && stampOf(SPECIAL_NIGHTS_PATH) == special_events_stamps[1]) {
+        return false;
+    }
+
+    Serial.println(F("Special events changed, reloading"));
+    if (!readSpecialBitmapsConfig()) {
+        Serial.println(F("Some special events were not loaded"));
+    }
+    return true;
+}
+
+static void markDays(SpecialEventTable& table, long first, long last, uint8_t picture) {
+    for (long days = first; days <= last; ++days) {
+        const CivilDate date = civilFromDays(days);
+        table.picture_by_day[DayOfYear(date.month, date.day).day] = picture;
+    }
+}
+
+// Days since epoch of the Easter Sunday, anonymous Gregorian algorithm
+static long easterSunday(int year) {
+    const int a = year % 19;
+    const int b = year / 100;
+    const int c = year % 100;
+    const int d = b / 4;
+    const int e = b % 4;
+    const int f = (b + 8) / 25;
+    const int g = (b - f + 1) / 3;
+    const int h = (19 * a + b - d - g + 15) % 30;
+    const int i = c / 4;
+    const int k = c % 4;
+    const int l = (32 + 2 * e + 2 * i - h - k) % 7;
+    const int m = (a + 11 * h + 22 * l) / 451;
+    const int month = (h + l - 7 * m + 114) / 31;
+    const int day = (h + l - 7 * m + 114) % 31 + 1;
+    return daysFromCivil(year, month, day);
+}
+
+static void compileRule(const SpecialEventRule& rule, int year, SpecialEventTable& table) {
+    switch (rule.kind) {
+    case SpecialEventRule::FixedDate:
+        table.picture_by_day[DayOfYear(rule.month, rule.day).day] = rule.picture;
+        break;
+
+    case SpecialEventRule::DateRange: {
+        // a range ending on February 29th ends on the 28th in other years
+        const bool short_february = rule.end_month == 2 && rule.end_day == 29 && !isLeapYear(year);
+        const long first = daysFromCivil(year, rule.month, rule.day);
+        const long last = daysFromCivil(year, rule.end_month, rule.end_day - short_february);
+        if (first <= last) {
+            markDays(table, first, last, rule.picture);
+        } else {
+            // wraps around the new year, both ends of this year are covered
+            markDays(table, first, daysFromCivil(year, 12, 31), rule.picture);
+            markDays(table, daysFromCivil(year, 1, 1), last, rule.picture);
+        }
+        break;
+    }
+
+    case SpecialEventRule::NthWeekday: {
+        const long days = nthWeekdayOfMonth(year, rule.month, rule.weekday, rule.week);
+        markDays(table, days, days, rule.picture);
+        break;
+    }
+
+    case SpecialEventRule::WeekdayOnDay:
+        for (int month = 1; month <= 12; ++month) {
+            const long days = daysFromCivil(year, month, rule.day);
+            const CivilDate date = civilFromDays(days);
+            // e.g. 31st doesn't exist in every month
+            if (date.month == month && weekdayFromDays(days) == rule.weekday) {
+                markDays(table, days, days, rule.picture);
+            }
+        }
+        break;
+
+    case SpecialEventRule::Easter: {
+        const long days = easterSunday(year) + rule.offset;
+        // the shifted day might fall into another year, it's not shown then
+        if (civilFromDays(days).year == year) {
+            markDays(table, days, days, rule.picture);
+        }
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+static void compileYear(int year) {
+    memset(special_days.picture_by_day, 0, sizeof(special_days.picture_by_day));
+    memset(special_nights.picture_by_day, 0, sizeof(special_nights.picture_by_day));
+
+    for (int kind = 0; kind < SpecialEventRule::KIND_COUNT; ++kind) {
+        for (int i = 0; i < special_rule_count; ++i) {
+            const SpecialEventRule& rule = special_rules[i];
+            if (rule.kind == kind) {
+                compileRule(rule, year, rule.is_night ? special_nights : special_days);
+            }
+        }
+    }
+}
+
+void prepareSpecialEvents(int year) {
+    if (year == compiled_year) {
+        return;
+    }
+
+    // the last day of the previous year, in the unused month 0
+    compileYear(year - 1);
+    const uint8_t last_day = special_days.picture_by_day[DayOfYear(12, 31).day];
+    const uint8_t last_night = special_nights.picture_by_day[DayOfYear(12, 31).day];
+
+    compileYear(year);
+    special_days.picture_by_day[PREVIOUS_YEAR_LAST_DAY.day] = last_day;
+    special_nights.picture_by_day[PREVIOUS_YEAR_LAST_DAY.day] = last_night;
+
+    compiled_year = year;
+    Serial.printf_P(PSTR("Special events compiled for year %d\n"), year);
+
+    if (rules_complete) {
+        saveSpecialEventsSnapshot();
+    }
+}
+
+AssetId getSpecialBackgroundAsset(DayOfYear doy, bool is_night, DisplayMode mode) {
+    const SpecialEventTable& table = is_night ? special_nights : special_days;
+    const uint8_t picture = doy.day < DAY_OF_YEAR_SLOTS ? table.picture_by_day[doy.day] : 0;
+
+    if (picture == 0) {
+        return NO_ASSET;
+    }
+
+    return mode == DisplayMode::Light
+        ? special_pictures[picture - 1].light
+        : special_pictures[picture - 1].dark;
+}
@@ -0,0 +1,50 @@
+#ifndef RWCLOCK_SPECIAL_EVENTS_HPP_
+#define RWCLOCK_SPECIAL_EVENTS_HPP_
+
+#include "config.hpp"
+#include "date_utils.hpp"
+
+#include <cstdint>
+
+// Special pictures are referenced by small IDs into a table of interned names
+using AssetId = uint8_t;
+constexpr AssetId NO_ASSET = 0;
+
+constexpr int MAX_SPECIAL_ASSETS = 48;
+constexpr int MAX_SPECIAL_PICTURES = 32;    // light/dark pairs
+constexpr int MAX_SPECIAL_RULES = 48;       // days and nights together
+constexpr int SPECIAL_NAMES_POOL_SIZE = 1024;
+
+// DayOfYear is month * 32 + day, so 31/12 is the last slot, 415
+constexpr int DAY_OF_YEAR_SLOTS = 13 * 32;
+
+// Keys of special_days.json and special_nights.json:
+//   "14/02"          fixed date, dd/mm
+//   "24/12-06/01"    range of dates, inclusive, may wrap around the new year
+//   "2nd sun/05"     n-th weekday of a month: 1st, 2nd, 3rd, 4th, 5th or last
+//   "fri 13"         every month on which a weekday falls on the given day
+//   "easter-2"       days relative to the (Gregorian) Easter Sunday
+// More specific rules win: fixed dates, then Easter, weekdays, and ranges.
+
+// Reads the rules from special_days.json and special_nights.json.
+// Returns false if some events couldn't be loaded, the details are on Serial.
+bool readSpecialBitmapsConfig();
+
+// Reads the rules again if either file changed since they were read,
+// returns true then. The tables are compiled by the next prepareSpecialEvents().
+bool reloadSpecialEventsIfChanged();
+
+// Before wakeup on the new year's day, the night still belongs to the last
+// day of the previous year, which is looked up with this day
+constexpr DayOfYear PREVIOUS_YEAR_LAST_DAY{ 0, 31 };
+
+// Compiles the rules into day-indexed tables for the calendar year, and
+// PREVIOUS_YEAR_LAST_DAY, only if the year changed since the last call,
+// or the rules were reloaded
+void prepareSpecialEvents(int year);
+
+// Constant time, NO_ASSET if there is no special picture for the day
+AssetId getSpecialBackgroundAsset(DayOfYear doy, bool is_night, DisplayMode mode);
+const char* getSpecialAssetName(AssetId id);
+
+#endif  // RWCLOCK_SPECIAL_EVENTS_HPP_
@@ -0,0 +1,251 @@
+#include "text_renderer.hpp"
+#include "display.hpp"
+#include "fonts.hpp"
+#include "raster_ops.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+// Copies `width` bits of a bit-packed PROGMEM glyph into a byte-aligned row
+static void readGlyphRow(const uint8_t* bitmap, uint32_t first_bit, int width, uint8_t* row) {
+    const uint8_t* bytes = bitmap + first_bit / 8;
+    const int shift = first_bit % 8;
+
+    for (int i = 0; i < (width + 7) / 8; ++i) {
+        const uint8_t high = pgm_read_byte(bytes + i);
+        // the next byte only if it holds bits of this row, it might be past the font
+        const bool spans = shift && width - i * 8 > 8 - shift;
+        const uint8_t low = spans ? pgm_read_byte(bytes + i + 1) : 0;
+        row[i] = (uint8_t)(high << shift) | (uint8_t)(low >> (8 - shift));
+    }
+}
+
+// Decodes the rows of a PROGMEM glyph one after another into byte-aligned rows
+class GlyphRowReader {
+  public:
+    GlyphRowReader(const uint8_t* bitmaps, const PlacedGlyph& glyph)
+        : bitmap_(bitmaps + glyph.bitmap_offset), width_(glyph.width),
+          encoding_(glyph.encoding) {}
+
+    void skip(int rows) {
+        if (encoding_ == GlyphEncoding::Bits) {
+            bit_ += (uint32_t)rows * width_;
+        } else {
+            decodeRuns(rows * width_, nullptr);
+        }
+    }
+
+    // (width + 7) / 8 bytes
+    void next(uint8_t* row) {
+        if (encoding_ == GlyphEncoding::Bits) {
+            readGlyphRow(bitmap_, bit_, width_, row);
+            bit_ += width_;
+        } else {
+            memset(row, 0, (width_ + 7) / 8);
+            decodeRuns(width_, row);
+        }
+    }
+
+  private:
+    // Consumes `pixels` pixels of the runs, setting the set ones in `row` if given
+    void decodeRuns(int pixels, uint8_t* row) {
+        for (int x = 0; x < pixels;) {
+            while (remaining_ == 0) {
+                // a length is a sum of bytes, 255 means that more follow
+                uint8_t byte;
+                do {
+                    byte = pgm_read_byte(bitmap_++);
+                    remaining_ += byte;
+                } while (byte == 255);
+                set_ = !set_;
+            }
+
+            const int count = std::min(remaining_, pixels - x);
+            if (set_ && row) {
+                for (int i = x; i < x + count; ++i) {
+                    row[i / 8] |= 0x80 >> (i % 8);
+                }
+            }
+            x += count;
+            remaining_ -= count;
+        }
+    }
+
+    const uint8_t* bitmap_;
+    int width_;
+    GlyphEncoding encoding_;
+    uint32_t bit_ = 0;              // Bits
+    int remaining_ = 0;             // Runs, of the current run
+    bool set_ = true;               // Runs, the first run is of unset pixels
+};
+
+GlyphCache temperature_glyphs;
+
+void initGlyphCaches() {
+    // '/' and ':' are the degree sign and 'C' in this font
+    if (!temperature_glyphs.build(&rodondo_digits_64pt, "0123456789-/:")) {
+        Serial.println(F("Temperature glyphs not cached, drawing them slowly"));
+    }
+    invalidateTextLayouts();
+}
+
+bool GlyphCache::build(const PackedFont* font, const char* chars) {
+    PackedFont f;
+    memcpy_P(&f, font, sizeof(f));
+
+    font_ = font;
+    memset(chars_, 0, sizeof(chars_));
+    memset(pool_, 0, sizeof(pool_));
+
+    int count = 0;
+    int used = 0;
+    for (const char* c = chars; *c; ++c) {
+        if (count == MAX_CACHED_GLYPHS || (uint8_t)*c < f.first || (uint8_t)*c > f.last) {
+            return false;
+        }
+
+        PackedGlyph g;
+        memcpy_P(&g, f.glyphs + ((uint8_t)*c - f.first), sizeof(g));
+
+        const int stride = (g.width + 7) / 8;
+        if (used + stride * g.height > GLYPH_CACHE_POOL_SIZE) {
+            return false;
+        }
+
+        const PlacedGlyph placed{ .width = g.width, .height = g.height,
+                                  .bitmap_offset = g.bitmap_offset, .encoding = g.encoding };
+        GlyphRowReader reader{f.bitmaps, placed};
+        for (int y = 0; y < g.height; ++y) {
+            reader.next(pool_ + used + y * stride);
+        }
+
+        offsets_[count] = (uint16_t)used;
+        chars_[count++] = *c;
+        used += stride * g.height;
+    }
+
+    return true;
+}
+
+const uint8_t* GlyphCache::rows(const PackedFont* font, char c) const {
+    if (font != font_ || c == '\0') {
+        return nullptr;
+    }
+
+    const char* found = strchr(chars_, c);
+    return found ? pool_ + offsets_[found - chars_] : nullptr;
+}
+
+static TextLayout text_layouts[TEXT_LAYOUT_CACHE_SIZE];
+static int next_text_layout = 0;    // replaced round-robin
+
+void invalidateTextLayouts() {
+    for (TextLayout& layout : text_layouts) {
+        layout.font = nullptr;
+    }
+}
+
+static void computeLayout(TextLayout& layout, const PackedFont* font, const char* text) {
+    PackedFont f;
+    memcpy_P(&f, font, sizeof(f));
+
+    layout.font = font;
+    strlcpy(layout.text, text, sizeof(layout.text));
+    layout.glyph_count = 0;
+
+    int min_x = INT16_MAX, min_y = INT16_MAX;
+    int max_x = -1, max_y = -1;
+    int cursor = 0;
+
+    for (const char* c = layout.text; *c; ++c) {
+        if ((uint8_t)*c < f.first || (uint8_t)*c > f.last) {
+            continue;
+        }
+
+        PackedGlyph g;
+        memcpy_P(&g, f.glyphs + ((uint8_t)*c - f.first), sizeof(g));
+
+        if (g.width > 0 && g.height > 0) {
+            const int x = cursor + g.x_offset;
+            const int y = g.y_offset;
+            min_x = std::min(min_x, x);
+            min_y = std::min(min_y, y);
+            max_x = std::max(max_x, x + g.width - 1);
+            max_y = std::max(max_y, y + g.height - 1);
+
+            layout.glyphs[layout.glyph_count++] = PlacedGlyph{
+                .x = (int16_t)x, .y = g.y_offset,
+                .width = g.width, .height = g.height,
+                .bitmap_offset = g.bitmap_offset, .encoding = g.encoding,
+                .cached_rows = temperature_glyphs.rows(font, *c) };
+        }
+
+        cursor += g.x_advance;
+    }
+
+    layout.x1 = max_x >= min_x ? min_x : 0;
+    layout.w  = max_x >= min_x ? max_x - min_x + 1 : 0;
+    layout.y1 = max_y >= min_y ? min_y : 0;
+    layout.h  = max_y >= min_y ? max_y - min_y + 1 : 0;
+}
+
+const TextLayout& layoutText(const PackedFont* font, const char* text) {
+    for (int i = 0; i < TEXT_LAYOUT_CACHE_SIZE; ++i) {
+        const TextLayout& layout = text_layouts[i];
+        if (layout.font == font && strncmp(layout.text, text, sizeof(layout.text) - 1) == 0) {
+            // the next miss replaces another layout than this one
+            next_text_layout = (i + 1) % TEXT_LAYOUT_CACHE_SIZE;
+            return layout;
+        }
+    }
+
+    TextLayout& layout = text_layouts[next_text_layout];
+    next_text_layout = (next_text_layout + 1) % TEXT_LAYOUT_CACHE_SIZE;
+    computeLayout(layout, font, text);
+    return layout;
+}
+
+void drawText(const TextLayout& layout, int x, int y, unsigned short color, int current_page) {
+    const BlitMode mode = color == GxEPD_WHITE ? BlitMode::Or : BlitMode::AndNot;
+    unsigned char* display_buffer = getDisplayBuffer();
+
+    PackedFont f;
+    memcpy_P(&f, layout.font, sizeof(f));
+
+    const int begin_draw_row = current_page * PAGE_HEIGHT;
+    const int end_draw_row   = (current_page + 1) * PAGE_HEIGHT;
+
+    for (int i = 0; i < layout.glyph_count; ++i) {
+        const PlacedGlyph& glyph = layout.glyphs[i];
+        const int glyph_x = x + glyph.x;
+        const int glyph_y = y + glyph.y;
+
+        const int begin_row = std::max(begin_draw_row, glyph_y);
+        const int end_row   = std::min(end_draw_row, glyph_y + glyph.height);
+        const int begin_col = std::max(0, glyph_x);
+        const int end_col   = std::min(WIDTH, glyph_x + glyph.width);
+
+        if (begin_row >= end_row || begin_col >= end_col) {
+            continue;
+        }
+
+        const int stride = (glyph.width + 7) / 8;
+        GlyphRowReader reader{f.bitmaps, glyph};
+        if (!glyph.cached_rows) {
+            reader.skip(begin_row - glyph_y);
+        }
+
+        for (int row = begin_row; row < end_row; ++row) {
+            alignas(4) uint8_t row_bits[32];
+            const uint8_t* glyph_row = row_bits;
+            if (glyph.cached_rows) {
+                glyph_row = glyph.cached_rows + (row - glyph_y) * stride;
+            } else {
+                reader.next(row_bits);
+            }
+
+            blitRow(display_buffer + WIDTH / 8 * (row - begin_draw_row), begin_col,
+                    glyph_row, begin_col - glyph_x, end_col - begin_col, mode);
+        }
+    }
+}
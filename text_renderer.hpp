@@ -0,0 +1,73 @@
+#ifndef RWCLOCK_TEXT_RENDERER_HPP_
+#define RWCLOCK_TEXT_RENDERER_HPP_
+
+#include <cstdint>
+#include "fonts.hpp"
+
+constexpr int GLYPH_CACHE_POOL_SIZE = 5632;  // the glyphs used of rodondo_digits_64pt take 5430 bytes
+constexpr int MAX_CACHED_GLYPHS = 16;
+
+constexpr int MAX_LAYOUT_TEXT = 32;          // fits the location, with the terminator
+constexpr int TEXT_LAYOUT_CACHE_SIZE = 2;    // the temperature and the location
+
+// Glyphs of a font expanded once into byte-aligned rows in RAM, so they are
+// drawn with the word raster kernels instead of decoded from PROGMEM
+class GlyphCache {
+  public:
+    // Expands the given characters of the font, false if some of them
+    // aren't in the font or don't fit, the ones before are still cached
+    bool build(const PackedFont* font, const char* chars);
+
+    // Rows of the glyph, (width + 7) / 8 bytes each, nullptr if not cached
+    const uint8_t* rows(const PackedFont* font, char c) const;
+
+  private:
+    const PackedFont* font_ = nullptr;
+    char chars_[MAX_CACHED_GLYPHS + 1] = {};
+    uint16_t offsets_[MAX_CACHED_GLYPHS] = {};  // in the pool
+    alignas(4) uint8_t pool_[GLYPH_CACHE_POOL_SIZE] = {};
+};
+
+// Digits, minus, degree and 'C' of rodondo_digits_64pt
+extern GlyphCache temperature_glyphs;
+
+void initGlyphCaches();
+
+// A glyph with its bitmap, relative to the cursor at the start of the text
+struct PlacedGlyph {
+    int16_t x;
+    int8_t y;
+    uint8_t width;
+    uint8_t height;
+    uint16_t bitmap_offset;         // in the font bitmaps
+    GlyphEncoding encoding;
+    const uint8_t* cached_rows;     // from a GlyphCache, or nullptr
+};
+
+struct TextLayout {
+    const PackedFont* font;
+    char text[MAX_LAYOUT_TEXT];
+    // the same as Adafruit_GFX::getTextBounds() at (0, 0), without line wrapping
+    int16_t x1;
+    int16_t y1;
+    uint16_t w;
+    uint16_t h;
+    uint8_t glyph_count;            // glyphs with pixels, the spaces are left out
+    PlacedGlyph glyphs[MAX_LAYOUT_TEXT];
+};
+
+// Memoized by the font and the text, longer texts are truncated.
+// The reference stays valid through the next call, so the temperature and
+// the location are both laid out before drawing them.
+const TextLayout& layoutText(const PackedFont* font, const char* text);
+
+// To be called when the glyph caches are rebuilt, the layouts point into them.
+// Changed texts don't need it, they are looked up by the whole text.
+void invalidateTextLayouts();
+
+// Draws the text with the cursor at (x, y), like Adafruit_GFX::print(), only
+// the set pixels, clipped to the screen and the current page. Glyphs outside
+// of the page are skipped without reading their bitmaps.
+void drawText(const TextLayout& layout, int x, int y, unsigned short color, int current_page);
+
+#endif  // RWCLOCK_TEXT_RENDERER_HPP_
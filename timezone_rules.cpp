@@ -0,0 +1,243 @@
+#include "timezone_rules.hpp"
+#include "date_utils.hpp"
+
+#include <Arduino.h>
+#include <cctype>
+#include <limits>
+#include <utility>
+
+namespace {
+
+struct TransitionRule {
+    enum Kind : unsigned char {
+        JulianNoLeap,   // Jn,    1 <= n <= 365, February 29th is never counted
+        JulianZero,     // n,     0 <= n <= 365
+        MonthWeekDay    // Mm.w.d
+    };
+
+    Kind kind = MonthWeekDay;
+    unsigned char month = 0;
+    unsigned char week = 0;
+    short day = 0;
+    long time = 2 * 3600;   // local time of the transition, 02:00 by default
+};
+
+struct PosixTimezone {
+    long std_offset = 0;    // east of UTC, in seconds
+    long dst_offset = 0;
+    bool has_dst = false;
+    TransitionRule dst_start;
+    TransitionRule dst_end;
+};
+
+struct OffsetCache {
+    time_t valid_from = 0;
+    time_t valid_until = 0;     // next transition, exclusive
+    long offset = 0;
+    bool is_dst = false;
+};
+
+}  // namespace
+
+static PosixTimezone timezone_rules;
+static OffsetCache offset_cache;
+
+static const char* parseName(const char* p) {
+    if (*p == '<') {
+        // quoted form, e.g. <+03>
+        while (*p && *p != '>') ++p;
+        return *p == '>' ? p + 1 : nullptr;
+    }
+
+    const char* begin = p;
+    while (isalpha((unsigned char)*p)) ++p;
+    return p - begin >= 3 ? p : nullptr;
+}
+
+static const char* parseNumber(const char* p, int max, int& out) {
+    if (!isdigit((unsigned char)*p)) return nullptr;
+
+    out = 0;
+    while (isdigit((unsigned char)*p)) {
+        out = out * 10 + (*p++ - '0');
+        if (out > max) return nullptr;
+    }
+    return p;
+}
+
+// [+|-]hh[:mm[:ss]], hours up to 167 as allowed by the RFC 8536 extension
+static const char* parseTime(const char* p, long& seconds) {
+    int sign = 1;
+    if (*p == '+' || *p == '-') {
+        sign = *p == '-' ? -1 : 1;
+        ++p;
+    }
+
+    int hours = 0, minutes = 0, secs = 0;
+    if (!(p = parseNumber(p, 167, hours))) return nullptr;
+    if (*p == ':' && !(p = parseNumber(p + 1, 59, minutes))) return nullptr;
+    if (*p == ':' && !(p = parseNumber(p + 1, 59, secs))) return nullptr;
+
+    seconds = sign * (hours * 3600L + minutes * 60L + secs);
+    return p;
+}
+
+static const char* parseRule(const char* p, TransitionRule& rule) {
+    int value = 0;
+    if (*p == 'M') {
+        int month = 0, week = 0, day = 0;
+        if (!(p = parseNumber(p + 1, 12, month)) || *p != '.') return nullptr;
+        if (!(p = parseNumber(p + 1, 5, week)) || *p != '.') return nullptr;
+        if (!(p = parseNumber(p + 1, 6, day))) return nullptr;
+        if (month < 1 || week < 1) return nullptr;
+
+        rule.kind = TransitionRule::MonthWeekDay;
+        rule.month = month;
+        rule.week = week;
+        rule.day = day;
+    } else if (*p == 'J') {
+        if (!(p = parseNumber(p + 1, 365, value)) || value < 1) return nullptr;
+        rule.kind = TransitionRule::JulianNoLeap;
+        rule.day = value;
+    } else {
+        if (!(p = parseNumber(p, 365, value))) return nullptr;
+        rule.kind = TransitionRule::JulianZero;
+        rule.day = value;
+    }
+
+    rule.time = 2 * 3600;
+    if (*p == '/') {
+        p = parseTime(p + 1, rule.time);
+    }
+    return p;
+}
+
+static bool parsePosixTimezone(const char* p, PosixTimezone& tz) {
+    tz = PosixTimezone{};
+    if (*p == '\0') {
+        return true;    // empty TZ is UTC
+    }
+
+    long offset = 0;
+    if (!(p = parseName(p)) || !(p = parseTime(p, offset))) return false;
+    // POSIX offsets are west of UTC, we keep them east of UTC
+    tz.std_offset = -offset;
+
+    if (*p == '\0') {
+        return true;
+    }
+
+    if (!(p = parseName(p))) return false;
+    tz.has_dst = true;
+    tz.dst_offset = tz.std_offset + 3600;
+
+    if (*p != ',' && *p != '\0') {
+        if (!(p = parseTime(p, offset))) return false;
+        tz.dst_offset = -offset;
+    }
+
+    if (*p == '\0') {
+        // no rules given, use the US ones, as glibc does
+        tz.dst_start = TransitionRule{ .month = 3, .week = 2, .day = 0 };
+        tz.dst_end = TransitionRule{ .month = 11, .week = 1, .day = 0 };
+        return true;
+    }
+
+    if (*p != ',' || !(p = parseRule(p + 1, tz.dst_start))) return false;
+    if (*p != ',' || !(p = parseRule(p + 1, tz.dst_end))) return false;
+    return *p == '\0';
+}
+
+// Days since epoch of the day on which the rule fires in a given year
+static long ruleDay(const TransitionRule& rule, int year) {
+    const long new_year = daysFromCivil(year, 1, 1);
+
+    switch (rule.kind) {
+    case TransitionRule::JulianNoLeap:
+        return new_year + rule.day - 1 + (isLeapYear(year) && rule.day >= 60);
+    case TransitionRule::JulianZero:
+        return new_year + rule.day;
+    case TransitionRule::MonthWeekDay:
+    default:
+        return nthWeekdayOfMonth(year, rule.month, rule.day, rule.week);
+    }
+}
+
+static void updateOffsetCache(time_t now) {
+    const PosixTimezone& tz = timezone_rules;
+
+    if (!tz.has_dst) {
+        offset_cache = OffsetCache{
+            .valid_from = std::numeric_limits<time_t>::min(),
+            .valid_until = std::numeric_limits<time_t>::max(),
+            .offset = tz.std_offset,
+            .is_dst = false
+        };
+        return;
+    }
+
+    struct tm utc {};
+    gmtime_r(&now, &utc);
+    const int year = utc.tm_year + 1900;
+
+    // Transitions of the neighbouring years, so the one before and after
+    // "now" are always present, also on the southern hemisphere
+    struct Transition {
+        time_t at;
+        bool to_dst;
+    } transitions[6];
+
+    int count = 0;
+    for (int y = year - 1; y <= year + 1; ++y) {
+        // Rule times are given in the local time in effect before the change
+        transitions[count++] = Transition{
+            (time_t)ruleDay(tz.dst_start, y) * 86400 + tz.dst_start.time - tz.std_offset,
+            true
+        };
+        transitions[count++] = Transition{
+            (time_t)ruleDay(tz.dst_end, y) * 86400 + tz.dst_end.time - tz.dst_offset,
+            false
+        };
+    }
+
+    for (int i = 1; i < count; ++i) {
+        for (int j = i; j > 0 && transitions[j - 1].at > transitions[j].at; --j) {
+            std::swap(transitions[j - 1], transitions[j]);
+        }
+    }
+
+    int last = 0;
+    while (last + 1 < count && transitions[last + 1].at <= now) ++last;
+
+    offset_cache = OffsetCache{
+        .valid_from = transitions[last].at,
+        .valid_until = transitions[last + 1].at,
+        .offset = transitions[last].to_dst ? tz.dst_offset : tz.std_offset,
+        .is_dst = transitions[last].to_dst
+    };
+}
+
+bool setTimezone(const char* posix_tz) {
+    bool parsed = parsePosixTimezone(posix_tz, timezone_rules);
+    if (!parsed) {
+        Serial.printf_P(PSTR("[TZ] Can't parse timezone: %s, using UTC\n"), posix_tz);
+        timezone_rules = PosixTimezone{};
+    }
+
+    // force recomputation on the next conversion
+    offset_cache = OffsetCache{};
+    return parsed;
+}
+
+void toLocalTime(time_t now, struct tm& out) {
+    if (now < offset_cache.valid_from || now >= offset_cache.valid_until) {
+        updateOffsetCache(now);
+        Serial.printf_P(PSTR("[TZ] UTC offset: %ld s, DST: %d, valid until: %lld\n"),
+                        offset_cache.offset, offset_cache.is_dst,
+                        (long long)offset_cache.valid_until);
+    }
+
+    const time_t local = now + offset_cache.offset;
+    gmtime_r(&local, &out);
+    out.tm_isdst = offset_cache.is_dst;
+}
@@ -0,0 +1,16 @@
+#ifndef RWCLOCK_TIMEZONE_RULES_HPP_
+#define RWCLOCK_TIMEZONE_RULES_HPP_
+
+#include <ctime>
+
+// Compact POSIX TZ engine ("CET-1CEST,M3.5.0/02,M10.5.0/03").
+// The rules are parsed once, then the current UTC offset is cached together
+// with the instant of the next DST transition, so converting to local time
+// is a single addition until that instant. No server or libc TZ is needed.
+
+// Returns false (and falls back to UTC) if the string can't be parsed
+bool setTimezone(const char* posix_tz);
+
+void toLocalTime(time_t now, struct tm& out);
+
+#endif  // RWCLOCK_TIMEZONE_RULES_HPP_
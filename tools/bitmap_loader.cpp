@@ -1,11 +1,18 @@
+#include <algorithm>
 #include <array>
 #include <bit>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <expected>
+#include <span>
 #include <vector>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include "bitmap_loader.hpp"
 
 using u16 = uint16_t;
@@ -99,86 +106,159 @@ struct BitmapInfoHeaderV5 {
 };
 static_assert(sizeof(BitmapInfoHeaderV5) == 124);
 
-struct BitmapCoreInfo {
-    u16 width;
-    u16 height;
+struct BitmapInfo {
+    i32 width;
+    i32 height;             // negative for top-down bitmaps
     u16 bits_per_pixel;
+    u32 compression = 0;
+    u32 image_size = 0;     // of the compressed data, 0 if not given
+    u32 colors_used = 0;    // 0 for all that the bits per pixel allow
+    u32 masks[3] = {};      // red, green, blue, if in the header
+    bool has_masks = false;
 };
 
 template <typename T>
-T from_bytes(void* data) {
+T from_bytes(const void* data) {
     unsigned char buffer[sizeof(T)];
     memcpy(buffer, data, sizeof(T));
     return std::bit_cast<T>(buffer);
 }
 
 template <typename Header>
-std::expected<BitmapCoreInfo, const char*> readBitmapInfoHeader(FILE* f) {
-    Header info_header;
-    unsigned char info_header_bytes[sizeof(info_header)]{};
-    if (fread(info_header_bytes + sizeof(u32), sizeof(info_header) - sizeof(u32), 1, f) != 1) {
+std::expected<BitmapInfo, const char*> readBitmapInfoHeader(std::span<const unsigned char> file) {
+    if (file.size() < FILE_HEADER_SIZE + sizeof(Header)) {
         return std::unexpected{"Cannot read bitmap info header"};
     }
-    memcpy(&info_header, info_header_bytes, sizeof(info_header));
+    const Header info_header = from_bytes<Header>(file.data() + FILE_HEADER_SIZE);
 
-    if ((info_header.width < 0) || (info_header.width > UINT16_MAX) ||
-        (info_header.height < 0) || (info_header.height > UINT16_MAX)) {
-        return std::unexpected{"Incorrect bitmap size in the header, bitmap too big?"};
-    }
+    BitmapInfo info{
+        .width = info_header.width,
+        .height = info_header.height,
+        .bits_per_pixel = info_header.bitCount
+    };
 
     if constexpr (!std::is_same_v<Header, BitmapCoreInfoHeader>) {
-        if (info_header.compression != 0) {
-            return std::unexpected{"This program doesn't accept compressed bitmaps"};
-        }
+        info.compression = info_header.compression;
+        info.image_size = info_header.sizeImage;
+        info.colors_used = info_header.clrUsed;
+    }
+    if constexpr (requires { info_header.redMask; }) {
+        info.masks[0] = info_header.redMask;
+        info.masks[1] = info_header.greenMask;
+        info.masks[2] = info_header.blueMask;
+        info.has_masks = true;
     }
 
-    return BitmapCoreInfo {
-        .width = static_cast<u16>(info_header.width),
-        .height = static_cast<u16>(info_header.height),
-        .bits_per_pixel = info_header.bitCount
-    };
+    // a negative height is a top-down bitmap, INT32_MIN can't be negated
+    if ((info.width < 0) || (info.width > UINT16_MAX) ||
+        (info.height < -UINT16_MAX) || (info.height > UINT16_MAX)) {
+        return std::unexpected{"Incorrect bitmap size in the header, bitmap too big?"};
+    }
+
+    return info;
 };
 
+static unsigned luminance(const unsigned char* bgr) {
+    return (bgr[2] * 299 + bgr[1] * 587 + bgr[0] * 114) / 1000;
+}
+
 struct FileGuard {
     FILE* f;
     ~FileGuard() { fclose(f); }
 };
 
-std::expected<BitmapData, const char*> loadBitmap(const char* filename) {
-    FILE* f = fopen(filename, "rb");
-    if (f == nullptr) {
+struct DescriptorGuard {
+    int fd;
+    ~DescriptorGuard() { close(fd); }
+};
+
+std::expected<FileMapping, const char*> FileMapping::open(const char* filename) {
+    const int fd = ::open(filename, O_RDONLY);
+    if (fd < 0) {
         return std::unexpected{"Cannot open the file for reading"};
     }
 
-    // closes file on function exit
-    FileGuard guard{f};
+    // the mapping stays valid after the descriptor is closed
+    DescriptorGuard guard{fd};
 
-    unsigned char header_bytes[FILE_HEADER_SIZE + sizeof(u32)];
-    if (fread(header_bytes, sizeof(header_bytes), 1, f) != 1) {
+    struct stat file_stat{};
+    if (fstat(fd, &file_stat) != 0) {
+        return std::unexpected{"Cannot read the file size"};
+    }
+    const size_t size = static_cast<size_t>(file_stat.st_size);
+    if (size == 0) {
+        return FileMapping{{}};
+    }
+
+    void* address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (address == MAP_FAILED) {
+        return std::unexpected{"Cannot map the file into memory"};
+    }
+    madvise(address, size, MADV_SEQUENTIAL);
+
+    return FileMapping{{static_cast<const unsigned char*>(address), size}};
+}
+
+FileMapping::~FileMapping() {
+    if (!bytes_.empty()) {
+        munmap(const_cast<unsigned char*>(bytes_.data()), bytes_.size());
+    }
+}
+
+std::span<const unsigned char> BitmapView::scanline(size_t row) const {
+    const size_t scanline_width = bitmapScanlineWidth(width, bits_per_pixel);
+    const size_t file_row = top_down ? height - 1 - row : row;
+    return data.subspan(file_row * scanline_width, scanline_width);
+}
+
+std::array<unsigned char, 3> BitmapView::color(size_t index) const {
+    const size_t offset = index * color_entry_size;
+    if (offset + 3 > color_map.size()) {
+        return {};  // black, if the color map is shorter than the bits per pixel allow
+    }
+    return { color_map[offset], color_map[offset + 1], color_map[offset + 2] };
+}
+
+bool BitmapView::hasCanonicalPixels() const {
+    if (compression != BitmapCompression::Rgb || top_down
+        || bits_per_pixel == 16 || bits_per_pixel == 32) {
+        return false;
+    }
+    return bits_per_pixel != 1 || luminance(color(0).data()) <= luminance(color(1).data());
+}
+
+std::expected<BitmapView, const char*> viewBitmap(const char* filename) {
+    auto mapping_result = FileMapping::open(filename);
+    if (!mapping_result) {
+        return std::unexpected{mapping_result.error()};
+    }
+
+    const std::span<const unsigned char> file = mapping_result->bytes();
+    if (file.size() < FILE_HEADER_SIZE + sizeof(u32)) {
         return std::unexpected{"The file is too short for a bitmap file"};
     }
-    if (header_bytes[0] != 'B' || header_bytes[1] != 'M') {
+    if (file[0] != 'B' || file[1] != 'M') {
         return std::unexpected{"The file is not a bitmap file"};
     }
 
     // offset of pixel data
-    const u32 data_offset = from_bytes<u32>(header_bytes + 10);
+    const u32 data_offset = from_bytes<u32>(file.data() + 10);
     // size of the info header, identifying its type
-    const u32 header_size = from_bytes<u32>(header_bytes + 14);
+    const u32 header_size = from_bytes<u32>(file.data() + 14);
 
-    std::expected<BitmapCoreInfo, const char*> read_info_header_result;
+    std::expected<BitmapInfo, const char*> read_info_header_result;
 
     if (header_size == sizeof(BitmapCoreInfoHeader)) {
-        read_info_header_result = readBitmapInfoHeader<BitmapCoreInfoHeader>(f);
+        read_info_header_result = readBitmapInfoHeader<BitmapCoreInfoHeader>(file);
     }
     else if (header_size == sizeof(BitmapInfoHeader)) {
-        read_info_header_result = readBitmapInfoHeader<BitmapInfoHeader>(f);
+        read_info_header_result = readBitmapInfoHeader<BitmapInfoHeader>(file);
     }
     else if (header_size == sizeof(BitmapInfoHeaderV4)) {
-        read_info_header_result = readBitmapInfoHeader<BitmapInfoHeaderV4>(f);
+        read_info_header_result = readBitmapInfoHeader<BitmapInfoHeaderV4>(file);
     }
     else if (header_size == sizeof(BitmapInfoHeaderV5)) {
-        read_info_header_result = readBitmapInfoHeader<BitmapInfoHeaderV5>(f);
+        read_info_header_result = readBitmapInfoHeader<BitmapInfoHeaderV5>(file);
     } else {
         return std::unexpected{"Unknown info header type"};
     }
@@ -187,36 +267,267 @@ std::expected<BitmapData, const char*> loadBitmap(const char* filename) {
         return std::unexpected{read_info_header_result.error()};
     }
 
-    const auto info = read_info_header_result.value();
-
-    if (info.bits_per_pixel != 1 &&
-        info.bits_per_pixel != 4 &&
-        info.bits_per_pixel != 8 &&
-        info.bits_per_pixel != 24) {
-        return std::unexpected{"The number of bits per pixel is not supported"};
+    BitmapInfo info = read_info_header_result.value();
+    size_t color_map_offset = FILE_HEADER_SIZE + header_size;
+
+    const auto compression = static_cast<BitmapCompression>(info.compression);
+    switch (compression) {
+        case BitmapCompression::Rgb:
+            if (info.bits_per_pixel != 1 && info.bits_per_pixel != 4 && info.bits_per_pixel != 8
+                && info.bits_per_pixel != 16 && info.bits_per_pixel != 24 && info.bits_per_pixel != 32) {
+                return std::unexpected{"The number of bits per pixel is not supported"};
+            }
+            break;
+        case BitmapCompression::Rle8:
+        case BitmapCompression::Rle4:
+            if (info.bits_per_pixel != (compression == BitmapCompression::Rle8 ? 8 : 4)) {
+                return std::unexpected{"The compression doesn't match the bits per pixel"};
+            }
+            if (info.height < 0) {
+                return std::unexpected{"Top-down bitmaps can't be compressed"};
+            }
+            break;
+        case BitmapCompression::Bitfields:
+            if (info.bits_per_pixel != 16 && info.bits_per_pixel != 32) {
+                return std::unexpected{"The compression doesn't match the bits per pixel"};
+            }
+            // the masks follow the basic info header
+            if (!info.has_masks) {
+                if (file.size() < color_map_offset + sizeof(info.masks)) {
+                    return std::unexpected{"Cannot read the color masks"};
+                }
+                memcpy(info.masks, file.data() + color_map_offset, sizeof(info.masks));
+                color_map_offset += sizeof(info.masks);
+            }
+            break;
+        default:
+            return std::unexpected{"The compression is not supported"};
     }
 
-    BitmapData result(info.width, info.height, info.bits_per_pixel);
+    // without the masks, 16 and 32 bpp are 5-5-5 and 8-8-8
+    if (compression == BitmapCompression::Rgb && info.bits_per_pixel == 16) {
+        info.masks[0] = 0x7C00; info.masks[1] = 0x03E0; info.masks[2] = 0x001F;
+    } else if (compression == BitmapCompression::Rgb && info.bits_per_pixel == 32) {
+        info.masks[0] = 0xFF0000; info.masks[1] = 0x00FF00; info.masks[2] = 0x0000FF;
+    }
 
-    // If the representation is not the standard triplet, we need to read the color map
-    const size_t color_map_size = result.color_map.size();
-    if (fread(result.color_map.data(), 1, color_map_size, f) != color_map_size) {
+    // The core header has RGB triplets in the color map, the others RGBQUADs
+    const size_t color_entry_size = header_size == sizeof(BitmapCoreInfoHeader) ? 3 : 4;
+    size_t color_count = 0;
+    if (info.bits_per_pixel <= 8) {
+        const size_t max_colors = size_t{1} << info.bits_per_pixel;
+        color_count = info.colors_used != 0 ? std::min<size_t>(info.colors_used, max_colors) : max_colors;
+    }
+    const size_t color_map_size = color_count * color_entry_size;
+    if (file.size() < color_map_offset + color_map_size) {
         return std::unexpected{"Cannot read the color map"};
     }
 
-    const size_t data_size = result.data.size();
-    fseek(f, data_offset, SEEK_SET);
-    if (fread(result.data.data(), 1, data_size, f) != data_size) {
+    const size_t width = static_cast<size_t>(info.width);
+    const size_t height = static_cast<size_t>(info.height < 0 ? -info.height : info.height);
+
+    // compressed data goes up to its size in the header, or to the end of the file
+    const bool compressed = compression == BitmapCompression::Rle8 || compression == BitmapCompression::Rle4;
+    size_t data_size = bitmapDataSize(width, height, info.bits_per_pixel);
+    if (compressed && data_offset <= file.size()) {
+        data_size = info.image_size != 0 ? info.image_size : file.size() - data_offset;
+    }
+    if (file.size() < data_offset || file.size() - data_offset < data_size) {
         return std::unexpected{"Cannot read pixel data"};
     }
 
+    return BitmapView {
+        .mapping = std::move(*mapping_result),
+        .data = file.subspan(data_offset, data_size),
+        .color_map = file.subspan(color_map_offset, color_map_size),
+        .width = width,
+        .height = height,
+        .bits_per_pixel = info.bits_per_pixel,
+        .color_entry_size = color_entry_size,
+        .compression = compression,
+        .top_down = info.height < 0,
+        .masks = { info.masks[0], info.masks[1], info.masks[2] }
+    };
+}
+
+// RLE8 and RLE4: pairs of (count, index) repeat an index, or alternate two
+// nibble indices, (0, 0) ends a line, (0, 1) the bitmap, (0, 2, dx, dy) moves
+// the position, and (0, n) is followed by n indices, padded to 16 bits.
+// Pixels that are skipped keep index 0.
+static std::expected<void, const char*> decodeRunLengths(const BitmapView& view, BitmapData& result) {
+    const std::span<const unsigned char> in = view.data;
+    const bool rle4 = view.compression == BitmapCompression::Rle4;
+    const size_t stride = bitmapScanlineWidth(result.width, result.bits_per_pixel);
+
+    size_t x = 0;
+    size_t y = 0;
+    const auto put = [&](unsigned index) {
+        if (x < result.width && y < result.height) {
+            unsigned char* row = result.data.data() + y * stride;
+            if (rle4) {
+                row[x / 2] |= static_cast<unsigned char>(x % 2 ? index : index << 4);
+            } else {
+                row[x] = static_cast<unsigned char>(index);
+            }
+        }
+        ++x;
+    };
+
+    size_t i = 0;
+    while (i + 1 < in.size()) {
+        const unsigned count = in[i];
+        const unsigned value = in[i + 1];
+        i += 2;
+
+        if (count > 0) {
+            if (!rle4 && x < result.width && y < result.height) {
+                // the common case, a run of bytes
+                const size_t run = std::min<size_t>(count, result.width - x);
+                memset(result.data.data() + y * stride + x, value, run);
+                x += count;
+                continue;
+            }
+            for (unsigned n = 0; n < count; ++n) {
+                put(rle4 ? (n % 2 ? value & 0xF : value >> 4) : value);
+            }
+            continue;
+        }
+
+        if (value == 0) {
+            x = 0;
+            ++y;
+        } else if (value == 1) {
+            return {};
+        } else if (value == 2) {
+            if (i + 1 >= in.size()) break;
+            x += in[i];
+            y += in[i + 1];
+            i += 2;
+        } else {
+            const size_t bytes = rle4 ? (value + 1) / 2 : value;
+            if (i + bytes > in.size()) {
+                return std::unexpected{"Compressed pixel data is truncated"};
+            }
+            for (unsigned n = 0; n < value; ++n) {
+                put(rle4 ? (n % 2 ? in[i + n / 2] & 0xF : in[i + n / 2] >> 4) : in[i + n]);
+            }
+            i += (bytes + 1) / 2 * 2;
+        }
+    }
+
+    // some encoders leave out the end of the bitmap
+    return {};
+}
+
+// 16 and 32 bpp, each channel scaled from its mask to 8 bits
+static void decodeBitfields(const BitmapView& view, BitmapData& result) {
+    struct Channel {
+        u32 mask;
+        int shift;
+        u32 max;
+    };
+    Channel channels[3];    // red, green, blue
+    for (int c = 0; c < 3; ++c) {
+        const u32 mask = view.masks[c];
+        const int shift = mask ? std::countr_zero(mask) : 0;
+        channels[c] = Channel{ mask, shift, mask >> shift };
+    }
+
+    const size_t bytes_per_pixel = view.bits_per_pixel / 8;
+    const size_t stride = bitmapScanlineWidth(result.width, 24);
+    for (size_t row = 0; row < result.height; ++row) {
+        const unsigned char* in = view.scanline(row).data();
+        unsigned char* out = result.data.data() + row * stride;
+        for (size_t x = 0; x < result.width; ++x, in += bytes_per_pixel, out += 3) {
+            const u32 value = bytes_per_pixel == 2 ? from_bytes<u16>(in) : from_bytes<u32>(in);
+            for (int c = 0; c < 3; ++c) {
+                const Channel& channel = channels[c];
+                out[2 - c] = channel.max
+                    ? static_cast<unsigned char>(((value & channel.mask) >> channel.shift) * 255 / channel.max)
+                    : 0;
+            }
+        }
+    }
+}
+
+// 1 is white on the device, a 1bpp bitmap with a brighter index 0 has its
+// bits inverted and the color map swapped. The padding of the rows stays 0.
+static void normalizePolarity(BitmapData& result) {
+    unsigned char* color_map = result.color_map.data();
+    if (luminance(color_map) <= luminance(color_map + 3)) {
+        return;
+    }
+    std::swap_ranges(color_map, color_map + 3, color_map + 3);
+
+    const size_t stride = bitmapScanlineWidth(result.width, 1);
+    const size_t used_bytes = (result.width + 7) / 8;
+    const size_t last_byte_bits = (result.width + 7) % 8 + 1;
+    const unsigned char last_byte_mask = static_cast<unsigned char>(0xFF << (8 - last_byte_bits));
+
+    // the rows are whole 32-bit words
+    for (size_t offset = 0; offset < result.data.size(); offset += 4) {
+        const u32 word = from_bytes<u32>(result.data.data() + offset);
+        const u32 inverted = ~word;
+        memcpy(result.data.data() + offset, &inverted, 4);
+    }
+    for (size_t row = 0; row < result.height && result.width > 0; ++row) {
+        unsigned char* line = result.data.data() + row * stride;
+        line[used_bytes - 1] &= last_byte_mask;
+        std::fill(line + used_bytes, line + stride, 0);
+    }
+}
+
+std::expected<BitmapData, const char*> decodeBitmap(const BitmapView& view) {
+    const bool true_color = view.bits_per_pixel > 8;
+    BitmapData result(view.width, view.height, true_color ? 24 : view.bits_per_pixel);
+
+    for (size_t i = 0; i < result.color_map.size() / 3; ++i) {
+        const auto color = view.color(i);
+        std::ranges::copy(color, result.color_map.begin() + i * 3);
+    }
+
+    if (view.compression == BitmapCompression::Rle8 || view.compression == BitmapCompression::Rle4) {
+        const auto decode_result = decodeRunLengths(view, result);
+        if (!decode_result) {
+            return std::unexpected{decode_result.error()};
+        }
+    } else if (view.bits_per_pixel == 16 || view.bits_per_pixel == 32) {
+        decodeBitfields(view, result);
+    } else if (!view.top_down) {
+        // the common case, the rows are already in place
+        std::ranges::copy(view.data, result.data.begin());
+    } else {
+        const size_t stride = bitmapScanlineWidth(result.width, result.bits_per_pixel);
+        for (size_t row = 0; row < result.height; ++row) {
+            std::ranges::copy(view.scanline(row), result.data.begin() + row * stride);
+        }
+    }
+
+    if (result.bits_per_pixel == 1) {
+        normalizePolarity(result);
+    }
     return result;
 }
 
+std::expected<BitmapData, const char*> loadBitmap(const char* filename) {
+    const auto view_result = viewBitmap(filename);
+    if (!view_result) {
+        return std::unexpected{view_result.error()};
+    }
+    return decodeBitmap(view_result.value());
+}
+
 std::expected<void, const char*> saveBitmap(const char* filename, const BitmapData& bitmap) {
+    // the info header and RGBQUAD entries, the clock only reads this layout
+    std::vector<unsigned char> color_map;
+    for (size_t i = 0; i + 3 <= bitmap.color_map.size(); i += 3) {
+        color_map.insert(color_map.end(), bitmap.color_map.begin() + i, bitmap.color_map.begin() + i + 3);
+        color_map.push_back(0);
+    }
+
     const size_t file_size_z = FILE_HEADER_SIZE
-                                + sizeof(BitmapCoreInfoHeader)
-                                + bitmap.color_map.size()
+                                + sizeof(BitmapInfoHeader)
+                                + color_map.size()
                                 + bitmap.data.size();
     if (file_size_z > UINT32_MAX) {
         return std::unexpected{"Bitmap is too big"};
@@ -226,8 +537,6 @@ std::expected<void, const char*> saveBitmap(const char* filename, const BitmapDa
     if (bitmap.height > UINT16_MAX || bitmap.width > UINT16_MAX) {
         return std::unexpected{"Bitmap dimentions are too big"};
     }
-    const u16 height = static_cast<u16>(bitmap.height);
-    const u16 width = static_cast<u16>(bitmap.width);
 
     FILE* f = fopen(filename, "wb");
     if (f == nullptr) {
@@ -243,20 +552,26 @@ std::expected<void, const char*> saveBitmap(const char* filename, const BitmapDa
     const u32 reserved_zero = 0;
     fwrite(&reserved_zero, sizeof(u32), 1, f);
     const u32 data_offset = static_cast<u32>(FILE_HEADER_SIZE
-                                                + sizeof(BitmapCoreInfoHeader)
-                                                + bitmap.color_map.size());
+                                                + sizeof(BitmapInfoHeader)
+                                                + color_map.size());
     fwrite(&data_offset, sizeof(u32), 1, f);
 
-    const BitmapCoreInfoHeader info_header {
-        .size = sizeof(BitmapCoreInfoHeader),
-        .width = width,
-        .height = height,
+    const BitmapInfoHeader info_header {
+        .size = sizeof(BitmapInfoHeader),
+        .width = static_cast<i32>(bitmap.width),
+        .height = static_cast<i32>(bitmap.height),
         .planes = 1,
-        .bitCount = static_cast<u16>(bitmap.bits_per_pixel)
+        .bitCount = static_cast<u16>(bitmap.bits_per_pixel),
+        .compression = 0,
+        .sizeImage = static_cast<u32>(bitmap.data.size()),
+        .xPelsPerMeter = 0,
+        .yPelsPerMeter = 0,
+        .clrUsed = static_cast<u32>(color_map.size() / 4),
+        .clrImportant = 0
     };
 
     fwrite(&info_header, sizeof(info_header), 1, f);
-    fwrite(bitmap.color_map.data(), bitmap.color_map.size(), 1, f);
+    fwrite(color_map.data(), color_map.size(), 1, f);
     fwrite(bitmap.data.data(), bitmap.data.size(), 1, f);
 
     if (ferror(f)) {
@@ -1,7 +1,11 @@
-#ifndef BITMAP_OADER_HPP
+#ifndef BITMAP_LOADER_HPP
 #define BITMAP_LOADER_HPP
 
+#include <array>
+#include <cstdint>
 #include <expected>
+#include <span>
+#include <utility>
 #include <vector>
 
 inline constexpr size_t bitmapColorMapSize(size_t bpp) {
@@ -34,8 +38,69 @@ struct BitmapData {
         , bits_per_pixel{bpp} { }
 };
 
+// A file mapped read-only into memory, unmapped when destroyed
+class FileMapping {
+  public:
+    static std::expected<FileMapping, const char*> open(const char* filename);
+
+    FileMapping(FileMapping&& other) noexcept : bytes_{std::exchange(other.bytes_, {})} {}
+    FileMapping& operator=(FileMapping&& other) noexcept {
+        std::swap(bytes_, other.bytes_);
+        return *this;
+    }
+    ~FileMapping();
+
+    std::span<const unsigned char> bytes() const { return bytes_; }
+
+  private:
+    explicit FileMapping(std::span<const unsigned char> bytes) : bytes_{bytes} {}
+
+    std::span<const unsigned char> bytes_;
+};
+
+enum class BitmapCompression : uint32_t {
+    Rgb = 0,
+    Rle8 = 1,
+    Rle4 = 2,
+    Bitfields = 3
+};
+
+// A bitmap read in place from its mapped file, without copying the pixels.
+// The spans stay valid as long as the view, also after it's moved.
+struct BitmapView {
+    FileMapping mapping;
+    std::span<const unsigned char> data;        // scanlines as in the file, or the compressed pixels
+    std::span<const unsigned char> color_map;   // entries as in the file, see color()
+    size_t width;
+    size_t height;
+    size_t bits_per_pixel;
+    size_t color_entry_size;    // 3 with the core header, 4 with the others
+    BitmapCompression compression;
+    bool top_down;              // negative height in the header
+    uint32_t masks[3];          // red, green, blue, for 16 and 32 bpp
+
+    // Uncompressed bitmaps only, rows counted from the bottom like in BitmapData
+    std::span<const unsigned char> scanline(size_t row) const;
+
+    // Blue, green, red of a color map entry, black past the end of the map
+    std::array<unsigned char, 3> color(size_t index) const;
+
+    // The pixels are laid out like decodeBitmap() would, they can be used in place
+    bool hasCanonicalPixels() const;
+};
+
+std::expected<BitmapView, const char*> viewBitmap(const char* filename);
+
+// Decodes the viewed bitmap into the layout of BitmapData: uncompressed rows
+// bottom-up, 1, 4, 8 or 24 bits per pixel (16 and 32 become 24), and a full
+// color map of triplets. For 1bpp, index 0 is the darker color and 1 the
+// brighter one, like on the device, where 1 is white.
+std::expected<BitmapData, const char*> decodeBitmap(const BitmapView& view);
+
+// Views and decodes the file, to be modified or written
 std::expected<BitmapData, const char*> loadBitmap(const char* filename);
-std::expected<void, const char*> saveBitmap(const char* filename, const BitmapData& bitmap);
 
+// Writes an uncompressed bitmap with the info header the clock reads
+std::expected<void, const char*> saveBitmap(const char* filename, const BitmapData& bitmap);
 
-#endif // BIRMAL_LOADER_HPP
+#endif // BITMAP_LOADER_HPP
@@ -1,68 +1,160 @@
+// Converts the 1bpp BMP files of the given directories into PROGMEM arrays,
+// named after the files. Compressed, top-down and inverted files are decoded
+// first, see decodeBitmap(). The files are converted on all the cores, and written
+// sorted by name, so the output only depends on the pictures. The output file
+// is left untouched if it wouldn't change, so it doesn't trigger a rebuild.
+// Build: g++ -std=c++2b -O2 -pthread -Itools tools/bitmap_to_code.cpp tools/bitmap_loader.cpp -o bitmap_to_code
+
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <optional>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
 #include "bitmap_loader.hpp"
 
-int main(int argc, const char* argv[]) {
-    if (argc != 3) {
-        std::cout << "Usage: ./bitmap_to_code path out_file" << std::endl;
-        return EXIT_FAILURE;
-    }
+namespace fs = std::filesystem;
 
-    namespace fs = std::filesystem;
+struct Conversion {
+    std::string code;
+    std::string error;      // empty if converted
+};
 
-    std::ofstream out{argv[2]};
-    out << std::hex;
+// "0x00, " to "0xff, ", looked up instead of formatted
+static constexpr auto HEX_BYTES = [] {
+    constexpr char digits[] = "0123456789abcdef";
+    std::array<std::array<char, 6>, 256> table{};
+    for (int b = 0; b < 256; ++b) {
+        table[b] = { '0', 'x', digits[b >> 4], digits[b & 0xF], ',', ' ' };
+    }
+    return table;
+}();
 
-    for (const fs::directory_entry& dir_entry: fs::directory_iterator{argv[1]}) {
-        const auto path = dir_entry.path();
-        if (path.extension() != ".bmp") {
-            continue;
+static void appendArray(std::string& out, const std::string& name,
+                        const std::vector<unsigned char>& bytes) {
+    out.reserve(out.size() + name.size() + bytes.size() * 6 + bytes.size() / 16 * 5 + 64);
+    out += "const unsigned char ";
+    out += name;
+    out += "[] PROGMEM {";
+    for (std::size_t idx = 0; idx < bytes.size(); ++idx) {
+        if (idx % 16 == 0) {
+            out += "\n    ";
         }
-        const auto name = path.stem();
-        
-        const auto load_result = loadBitmap(path.c_str());
+        out.append(HEX_BYTES[bytes[idx]].data(), 6);
+    }
+    out += "\n};\n\n";
+}
 
-        if (!load_result) {
-            std::cout << "Cannot load file: " << path << ", "
-                      << load_result.error() << std::endl;
-            return EXIT_FAILURE;
-        }
+static Conversion convert(const fs::path& path) {
+    const auto view_result = viewBitmap(path.c_str());
+    if (!view_result) {
+        return { {}, "Cannot load file: " + path.string() + ", " + view_result.error() };
+    }
+    const BitmapView& view = view_result.value();
 
-        const auto bmp = load_result.value();
-        const auto scanline_width = bitmapScanlineWidth(bmp.width, bmp.bits_per_pixel);
-        if (bmp.height * scanline_width != bmp.data.size()) {
-            std::cout << "Wrong bitmap width: " << bmp.width << std::endl;
-            return EXIT_FAILURE;
+    // pictures already laid out like on the device are read in place
+    std::span<const unsigned char> data = view.data;
+    size_t bits_per_pixel = view.bits_per_pixel;
+    std::optional<BitmapData> decoded;
+    if (!view.hasCanonicalPixels()) {
+        auto decode_result = decodeBitmap(view);
+        if (!decode_result) {
+            return { {}, "Cannot decode file: " + path.string() + ", " + decode_result.error() };
         }
+        decoded = std::move(decode_result.value());
+        data = decoded->data;
+        bits_per_pixel = decoded->bits_per_pixel;
+    }
+
+    const auto scanline_width = bitmapScanlineWidth(view.width, bits_per_pixel);
+    if (view.height * scanline_width != data.size()) {
+        return { {}, "Wrong bitmap width: " + std::to_string(view.width) };
+    }
+
+    if (bits_per_pixel != 1) {
+        return { {}, "Wrong bits per pixel: " + std::to_string(bits_per_pixel) };
+    }
+
+    std::vector<unsigned char> buffer(view.width * view.height * bits_per_pixel / 8);
+
+    // copy the lines in reverse order to the buffer
+    for (std::size_t row = 0; row < view.height; ++row) {
+        std::size_t offset = row * scanline_width;
+        std::size_t dest_offset = (view.height - 1 - row) * scanline_width;
+        std::copy_n(data.begin() + offset, scanline_width,
+                    buffer.begin() + dest_offset);
+    }
+
+    Conversion result;
+    appendArray(result.code, path.stem().string(), buffer);
+    return result;
+}
 
-        if (bmp.bits_per_pixel != 1) {
-            std::cout << "Wrong bits per pixel: " << bmp.bits_per_pixel << std::endl;
+int main(int argc, const char* argv[]) {
+    if (argc < 3) {
+        std::cout << "Usage: ./bitmap_to_code path [path...] out_file" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::vector<fs::path> paths;
+    for (int i = 1; i < argc - 1; ++i) {
+        std::error_code error;
+        fs::directory_iterator directory{argv[i], error};
+        if (error) {
+            std::cout << "Cannot read directory: " << argv[i] << ", " << error.message() << std::endl;
             return EXIT_FAILURE;
         }
+        for (const fs::directory_entry& dir_entry: directory) {
+            if (dir_entry.path().extension() == ".bmp") {
+                paths.push_back(dir_entry.path());
+            }
+        }
+    }
+    std::sort(paths.begin(), paths.end(), [](const fs::path& a, const fs::path& b) {
+        return a.filename() != b.filename() ? a.filename() < b.filename() : a < b;
+    });
 
-        std::vector<unsigned char> buffer(bmp.width * bmp.height * bmp.bits_per_pixel / 8);
-        
-        // copy the lines in reverse order to the buffer
-        for (std::size_t row = 0; row < bmp.height; ++row) {
-            std::size_t offset = row * scanline_width;
-            std::size_t dest_offset = (bmp.height - 1 - row) * scanline_width;
-            std::copy_n(bmp.data.begin() + offset, scanline_width,
-                        buffer.begin() + dest_offset);
+    // each worker takes the next file until none are left
+    std::vector<Conversion> conversions(paths.size());
+    std::atomic<std::size_t> next_path{0};
+    const auto worker = [&] {
+        for (std::size_t i; (i = next_path++) < paths.size();) {
+            conversions[i] = convert(paths[i]);
         }
+    };
 
-        out << "const unsigned char " << name.c_str() << "[] PROGMEM {";
-        for (std::size_t idx = 0; unsigned char b : buffer) {
-            if (idx % 16 == 0) {
-                out << "\n    ";
-            }
+    const std::size_t worker_count = std::clamp<std::size_t>(
+        std::thread::hardware_concurrency(), 1, std::max<std::size_t>(paths.size(), 1));
+    {
+        std::vector<std::jthread> workers;
+        for (std::size_t i = 1; i < worker_count; ++i) {
+            workers.emplace_back(worker);
+        }
+        worker();
+    }
 
-            out << "0x" << std::setw(2) << std::setfill('0') << std::right << unsigned{b} << ", ";
-            ++idx;
+    std::string out;
+    for (const Conversion& conversion : conversions) {
+        if (!conversion.error.empty()) {
+            std::cout << conversion.error << std::endl;
+            return EXIT_FAILURE;
         }
+        out += conversion.code;
+    }
 
-        out << "\n};\n\n";
+    std::ifstream previous{argv[argc - 1], std::ios::binary};
+    if (previous) {
+        const std::string previous_out{std::istreambuf_iterator<char>{previous}, {}};
+        if (previous_out == out) {
+            return EXIT_SUCCESS;
+        }
     }
-}
 
+    std::ofstream{argv[argc - 1], std::ios::binary} << out;
+}
@@ -0,0 +1,94 @@
+// Converts a grayscale or color BMP into a 2bpp gray picture for the clock,
+// see BitmapFormat::Gray2 in bitmap_selector.hpp for the format.
+// The levels are only quantized, the clock dithers them when drawing.
+// Build from the repository root, which has packbits.hpp:
+//   g++ -std=c++2b -O2 -I. -Itools tools/bitmap_to_gray.cpp tools/bitmap_loader.cpp -o bitmap_to_gray
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include "bitmap_loader.hpp"
+#include "packbits.hpp"
+
+static unsigned luminance(unsigned blue, unsigned green, unsigned red) {
+    return (red * 299 + green * 587 + blue * 114) / 1000;
+}
+
+static unsigned pixelLuminance(const BitmapData& bmp, size_t row, size_t x) {
+    const unsigned char* scanline
+        = bmp.data.data() + row * bitmapScanlineWidth(bmp.width, bmp.bits_per_pixel);
+
+    if (bmp.bits_per_pixel == 24) {
+        const unsigned char* p = scanline + x * 3;
+        return luminance(p[0], p[1], p[2]);
+    }
+
+    const size_t bit = x * bmp.bits_per_pixel;
+    const unsigned mask = (1u << bmp.bits_per_pixel) - 1;
+    const unsigned index = (scanline[bit / 8] >> (8 - bmp.bits_per_pixel - bit % 8)) & mask;
+    const unsigned char* color = bmp.color_map.data() + index * 3;
+    return luminance(color[0], color[1], color[2]);
+}
+
+int main(int argc, const char* argv[]) {
+    if (argc != 3) {
+        std::cout << "Usage: ./bitmap_to_gray in_file.bmp out_file" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const auto load_result = loadBitmap(argv[1]);
+    if (!load_result) {
+        std::cout << "Cannot load file: " << argv[1] << ", "
+                  << load_result.error() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const BitmapData& bmp = load_result.value();
+    if (bmp.width > UINT16_MAX || bmp.height > UINT16_MAX) {
+        std::cout << "Bitmap too big" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const size_t stride = (bmp.width + 7) / 8;
+    const uint32_t header_size = 8 + 4 * (static_cast<uint32_t>(bmp.height) + 1);
+
+    std::vector<uint32_t> row_offsets;
+    std::vector<unsigned char> rows;
+
+    for (size_t y = 0; y < bmp.height; ++y) {
+        // the gray rows go top-down, BMP rows bottom-up
+        const size_t bmp_row = bmp.height - 1 - y;
+
+        std::vector<unsigned char> planes(2 * stride);
+        for (size_t x = 0; x < bmp.width; ++x) {
+            const unsigned level = (pixelLuminance(bmp, bmp_row, x) * 3 + 127) / 255;
+            const unsigned char bit = static_cast<unsigned char>(0x80 >> (x % 8));
+            if (level & 2) planes[x / 8] |= bit;
+            if (level & 1) planes[stride + x / 8] |= bit;
+        }
+
+        row_offsets.push_back(header_size + static_cast<uint32_t>(rows.size()));
+        const size_t packed_at = rows.size();
+        rows.resize(packed_at + 2 * planes.size());
+        rows.resize(packed_at + packBits(planes.data(), planes.size(), rows.data() + packed_at));
+    }
+    row_offsets.push_back(header_size + static_cast<uint32_t>(rows.size()));
+
+    std::ofstream out{argv[2], std::ios::binary};
+    const uint16_t width = static_cast<uint16_t>(bmp.width);
+    const uint16_t height = static_cast<uint16_t>(bmp.height);
+    out.write("RWG2", 4);
+    out.write(reinterpret_cast<const char*>(&width), sizeof(width));
+    out.write(reinterpret_cast<const char*>(&height), sizeof(height));
+    out.write(reinterpret_cast<const char*>(row_offsets.data()), row_offsets.size() * sizeof(uint32_t));
+    out.write(reinterpret_cast<const char*>(rows.data()), rows.size());
+
+    if (!out) {
+        std::cout << "Cannot write file: " << argv[2] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << bmp.width << "x" << bmp.height << ", " << rows.size()
+              << " bytes of compressed rows" << std::endl;
+}
@@ -0,0 +1,383 @@
+// Dithers grayscale pictures into the 1bpp light and dark BMPs of the clock,
+// out_dir/<name>_light.bmp and out_dir/<name>_dark.bmp. The dark variant is
+// dithered from the inverted levels, not inverted after dithering.
+// Input is any BMP that bitmap_loader decodes, or a binary PGM (P5), which
+// GIMP exports from the XCF and PNG originals in extras/.
+//
+// Options:
+//   --method floyd-steinberg | atkinson | ordered    (default floyd-steinberg)
+//   --gamma g       levels raised to the power g > 0 first, 2.2 for linear light
+//   --threshold t   the level between black and white, 0 to 255, 128 by default
+//
+// Build: g++ -std=c++2b -O2 -pthread -Itools tools/dither.cpp tools/bitmap_loader.cpp -o dither
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+#include "bitmap_loader.hpp"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace fs = std::filesystem;
+
+enum class DitherMethod {
+    FloydSteinberg,
+    Atkinson,
+    Ordered
+};
+
+struct DitherOptions {
+    DitherMethod method = DitherMethod::FloydSteinberg;
+    double gamma = 1.0;
+    int threshold = 128;
+};
+
+// 8-bit levels, rows top-down
+struct GrayImage {
+    size_t width = 0;
+    size_t height = 0;
+    std::vector<uint8_t> levels;
+};
+
+static unsigned luminance(const unsigned char* bgr) {
+    return (bgr[2] * 299 + bgr[1] * 587 + bgr[0] * 114) / 1000;
+}
+
+static std::expected<GrayImage, std::string> loadPgm(const char* filename) {
+    std::ifstream in{filename, std::ios::binary};
+    std::string magic;
+    size_t width = 0, height = 0;
+    unsigned max_value = 0;
+
+    // the header fields are separated by whitespace, with # comments
+    const auto field = [&](auto& value) {
+        while (in >> std::ws && in.peek() == '#') {
+            in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        }
+        in >> value;
+    };
+    field(magic);
+    field(width);
+    field(height);
+    field(max_value);
+    in.get();
+
+    if (!in || magic != "P5" || max_value == 0 || max_value > 255) {
+        return std::unexpected{"Only binary 8-bit PGM files are supported"};
+    }
+
+    GrayImage image{ width, height, std::vector<uint8_t>(width * height) };
+    if (!in.read(reinterpret_cast<char*>(image.levels.data()), image.levels.size())) {
+        return std::unexpected{"Cannot read pixel data"};
+    }
+    if (max_value != 255) {
+        for (uint8_t& level : image.levels) {
+            level = static_cast<uint8_t>(level * 255 / max_value);
+        }
+    }
+    return image;
+}
+
+static std::expected<GrayImage, std::string> loadGray(const fs::path& path) {
+    if (path.extension() == ".pgm") {
+        return loadPgm(path.c_str());
+    }
+
+    const auto load_result = loadBitmap(path.c_str());
+    if (!load_result) {
+        return std::unexpected{load_result.error()};
+    }
+
+    const BitmapData& bmp = load_result.value();
+    const size_t stride = bitmapScanlineWidth(bmp.width, bmp.bits_per_pixel);
+    GrayImage image{ bmp.width, bmp.height, std::vector<uint8_t>(bmp.width * bmp.height) };
+
+    // luminance of each color map entry, so the pixels are only looked up
+    std::array<uint8_t, 256> palette{};
+    for (size_t i = 0; i < bmp.color_map.size() / 3; ++i) {
+        palette[i] = static_cast<uint8_t>(luminance(bmp.color_map.data() + i * 3));
+    }
+
+    for (size_t y = 0; y < bmp.height; ++y) {
+        // BMP rows go bottom-up
+        const unsigned char* scanline = bmp.data.data() + (bmp.height - 1 - y) * stride;
+        uint8_t* out = image.levels.data() + y * bmp.width;
+        for (size_t x = 0; x < bmp.width; ++x) {
+            if (bmp.bits_per_pixel == 24) {
+                out[x] = static_cast<uint8_t>(luminance(scanline + x * 3));
+                continue;
+            }
+            const size_t bit = x * bmp.bits_per_pixel;
+            const unsigned mask = (1u << bmp.bits_per_pixel) - 1;
+            out[x] = palette[(scanline[bit / 8] >> (8 - bmp.bits_per_pixel - bit % 8)) & mask];
+        }
+    }
+    return image;
+}
+
+// Gamma and the threshold in one table, the threshold moves to 128 after it
+static std::array<uint8_t, 256> levelTable(const DitherOptions& options, bool inverted) {
+    std::array<uint8_t, 256> table{};
+    for (int level = 0; level < 256; ++level) {
+        const int source = inverted ? 255 - level : level;
+        const double corrected = 255.0 * std::pow(source / 255.0, options.gamma);
+        const long biased = std::lround(corrected) + 128 - options.threshold;
+        table[level] = static_cast<uint8_t>(std::clamp<long>(biased, 0, 255));
+    }
+    return table;
+}
+
+static void applyTable(const std::array<uint8_t, 256>& table, const uint8_t* in, uint8_t* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = table[in[i]];
+    }
+}
+
+// MSB first, like in BMP files, set bits are white
+static void setWhite(unsigned char* row, size_t x) {
+    row[x / 8] |= static_cast<unsigned char>(0x80 >> (x % 8));
+}
+
+// Bayer 8x8, the thresholds spread evenly over (0, 256)
+static constexpr auto BAYER_THRESHOLDS = [] {
+    std::array<std::array<uint8_t, 8>, 8> thresholds{};
+    for (int y = 0; y < 8; ++y) {
+        for (int x = 0; x < 8; ++x) {
+            int index = 0;
+            for (int bit = 2; bit >= 0; --bit) {
+                const int xb = (x >> (2 - bit)) & 1;
+                const int yb = (y >> (2 - bit)) & 1;
+                index |= ((xb ^ yb) << (2 * bit + 1)) | (yb << (2 * bit));
+            }
+            thresholds[y][x] = static_cast<uint8_t>(index * 4 + 2);
+        }
+    }
+    return thresholds;
+}();
+
+static constexpr auto REVERSED_BITS = [] {
+    std::array<uint8_t, 256> table{};
+    for (int b = 0; b < 256; ++b) {
+        int reversed = 0;
+        for (int bit = 0; bit < 8; ++bit) {
+            reversed |= ((b >> bit) & 1) << (7 - bit);
+        }
+        table[b] = static_cast<uint8_t>(reversed);
+    }
+    return table;
+}();
+
+// Levels above the thresholds are white. With SSE2, 16 pixels are compared
+// at once, and the comparison mask is the packed row.
+static void thresholdRow(const uint8_t* levels, const uint8_t* thresholds, size_t width, unsigned char* row) {
+    size_t x = 0;
+#ifdef __SSE2__
+    const __m128i sign = _mm_set1_epi8(static_cast<char>(0x80));
+    for (; x + 16 <= width; x += 16) {
+        const __m128i level = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(levels + x)), sign);
+        const __m128i threshold = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(thresholds + x)), sign);
+        const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpgt_epi8(level, threshold)));
+        // the mask has the first pixel in its lowest bit
+        row[x / 8] = REVERSED_BITS[mask & 0xFF];
+        row[x / 8 + 1] = REVERSED_BITS[mask >> 8];
+    }
+#endif
+    for (; x < width; ++x) {
+        if (levels[x] > thresholds[x]) setWhite(row, x);
+    }
+}
+
+// Each row of the output is written bottom-up into `bmp`
+static void ditherOrdered(const GrayImage& image, const std::array<uint8_t, 256>& table, BitmapData& bmp) {
+    const size_t stride = bitmapScanlineWidth(image.width, 1);
+    std::vector<uint8_t> levels(image.width);
+    std::vector<uint8_t> thresholds(image.width + 16);
+
+    for (size_t y = 0; y < image.height; ++y) {
+        for (size_t x = 0; x < image.width; ++x) {
+            thresholds[x] = BAYER_THRESHOLDS[y % 8][x % 8];
+        }
+        applyTable(table, image.levels.data() + y * image.width, levels.data(), image.width);
+        thresholdRow(levels.data(), thresholds.data(), image.width,
+                     bmp.data.data() + (image.height - 1 - y) * stride);
+    }
+}
+
+// Error diffusion streams over the rows, keeping the errors of the rows
+// below in a ring of three. Each kernel entry is (dx, dy, weight).
+struct DiffusionWeight {
+    int dx;
+    int dy;
+    int weight;
+};
+
+static void ditherDiffusion(const GrayImage& image, const std::array<uint8_t, 256>& table,
+                            std::span<const DiffusionWeight> kernel, int divisor, BitmapData& bmp) {
+    const size_t stride = bitmapScanlineWidth(image.width, 1);
+    constexpr int MARGIN = 2;
+    const size_t padded_width = image.width + 2 * MARGIN;
+
+    std::array<std::vector<int>, 3> errors;
+    for (auto& row : errors) row.assign(padded_width, 0);
+    std::vector<uint8_t> levels(image.width);
+
+    for (size_t y = 0; y < image.height; ++y) {
+        std::vector<int>& current = errors[y % 3];
+        applyTable(table, image.levels.data() + y * image.width, levels.data(), image.width);
+        unsigned char* row = bmp.data.data() + (image.height - 1 - y) * stride;
+
+        for (size_t x = 0; x < image.width; ++x) {
+            const int value = levels[x] + current[x + MARGIN] / divisor;
+            const int output = value >= 128 ? 255 : 0;
+            if (output) setWhite(row, x);
+
+            const int error = value - output;
+            for (const DiffusionWeight& w : kernel) {
+                errors[(y + w.dy) % 3][x + MARGIN + w.dx] += error * w.weight;
+            }
+        }
+        std::fill(current.begin(), current.end(), 0);
+    }
+}
+
+static constexpr DiffusionWeight FLOYD_STEINBERG[] = {
+    { 1, 0, 7 }, { -1, 1, 3 }, { 0, 1, 5 }, { 1, 1, 1 }
+};
+
+// only 3/4 of the error is spread, which keeps the highlights and shadows clean
+static constexpr DiffusionWeight ATKINSON[] = {
+    { 1, 0, 1 }, { 2, 0, 1 }, { -1, 1, 1 }, { 0, 1, 1 }, { 1, 1, 1 }, { 0, 2, 1 }
+};
+
+static BitmapData dither(const GrayImage& image, const DitherOptions& options, bool inverted) {
+    BitmapData bmp(image.width, image.height, 1);
+    const unsigned char black_and_white[] = { 0, 0, 0, 255, 255, 255 };
+    std::copy(std::begin(black_and_white), std::end(black_and_white), bmp.color_map.begin());
+
+    const auto table = levelTable(options, inverted);
+    switch (options.method) {
+        case DitherMethod::FloydSteinberg:
+            ditherDiffusion(image, table, FLOYD_STEINBERG, 16, bmp);
+            break;
+        case DitherMethod::Atkinson:
+            ditherDiffusion(image, table, ATKINSON, 8, bmp);
+            break;
+        case DitherMethod::Ordered:
+            ditherOrdered(image, table, bmp);
+            break;
+    }
+    return bmp;
+}
+
+// The whole value has to be a number
+template <typename T>
+static bool parseNumber(const std::string& text, T& value) {
+    const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    return error == std::errc{} && end == text.data() + text.size();
+}
+
+static std::string convert(const fs::path& path, const fs::path& out_dir, const DitherOptions& options) {
+    const auto load_result = loadGray(path);
+    if (!load_result) {
+        return "Cannot load file: " + path.string() + ", " + load_result.error();
+    }
+
+    for (const bool dark : { false, true }) {
+        const fs::path out_path = out_dir / (path.stem().string() + (dark ? "_dark.bmp" : "_light.bmp"));
+        const auto save_result = saveBitmap(out_path.c_str(), dither(load_result.value(), options, dark));
+        if (!save_result) {
+            return "Cannot write file: " + out_path.string() + ", " + save_result.error();
+        }
+    }
+    return {};
+}
+
+int main(int argc, const char* argv[]) {
+    DitherOptions options;
+    std::vector<fs::path> paths;
+
+    int arg = 1;
+    for (; arg + 1 < argc && std::strncmp(argv[arg], "--", 2) == 0; arg += 2) {
+        const std::string option = argv[arg];
+        const std::string value = argv[arg + 1];
+        bool valid = true;
+        if (option == "--method" && value == "floyd-steinberg") {
+            options.method = DitherMethod::FloydSteinberg;
+        } else if (option == "--method" && value == "atkinson") {
+            options.method = DitherMethod::Atkinson;
+        } else if (option == "--method" && value == "ordered") {
+            options.method = DitherMethod::Ordered;
+        } else if (option == "--gamma") {
+            valid = parseNumber(value, options.gamma) && options.gamma > 0;
+        } else if (option == "--threshold") {
+            valid = parseNumber(value, options.threshold)
+                    && options.threshold >= 0 && options.threshold <= 255;
+        } else {
+            valid = false;
+        }
+
+        if (!valid) {
+            std::cout << "Wrong option: " << option << " " << value << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    for (; arg < argc - 1; ++arg) {
+        paths.push_back(argv[arg]);
+    }
+
+    if (paths.empty()) {
+        std::cout << "Usage: ./dither [--method floyd-steinberg|atkinson|ordered] [--gamma g]"
+                     " [--threshold t] in_file [in_file...] out_dir" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const fs::path out_dir = argv[argc - 1];
+
+    std::error_code create_error;
+    fs::create_directories(out_dir, create_error);
+    if (create_error) {
+        std::cout << "Cannot create the directory " << out_dir.string() << ": "
+                  << create_error.message() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // each worker takes the next file until none are left
+    std::vector<std::string> errors(paths.size());
+    std::atomic<std::size_t> next_path{0};
+    const auto worker = [&] {
+        for (std::size_t i; (i = next_path++) < paths.size();) {
+            errors[i] = convert(paths[i], out_dir, options);
+        }
+    };
+
+    const std::size_t worker_count = std::clamp<std::size_t>(
+        std::thread::hardware_concurrency(), 1, paths.size());
+    {
+        std::vector<std::jthread> workers;
+        for (std::size_t i = 1; i < worker_count; ++i) {
+            workers.emplace_back(worker);
+        }
+        worker();
+    }
+
+    for (const std::string& error : errors) {
+        if (!error.empty()) {
+            std::cout << error << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+}
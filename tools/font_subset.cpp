@@ -0,0 +1,241 @@
+// Generates a PackedFont (see fonts.hpp) from an Adafruit_GFX font source,
+// with only the given characters. Each glyph is stored bit-packed like in
+// GFXfont, or as run lengths, whichever is smaller.
+//
+// Run lengths alternate between unset and set pixels, starting with unset ones,
+// over the rows of the glyph one after another, up to the last pixel. Each
+// length is a sequence of bytes added together, all but the last one being 255.
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct Glyph {
+    long bitmap_offset;
+    long width;
+    long height;
+    long x_advance;
+    long x_offset;
+    long y_offset;
+};
+
+struct Font {
+    std::string comments;   // the leading comments, like the font author
+    std::vector<unsigned char> bitmaps;
+    std::vector<Glyph> glyphs;
+    long first;
+    long last;
+    long y_advance;
+};
+
+static std::string stripComments(const std::string& source) {
+    std::string result;
+    for (size_t i = 0; i < source.size(); ++i) {
+        if (source.compare(i, 2, "//") == 0) {
+            i = source.find('\n', i);
+            if (i == std::string::npos) break;
+        } else if (source.compare(i, 2, "/*") == 0) {
+            i = source.find("*/", i);
+            if (i == std::string::npos) break;
+            ++i;
+            continue;
+        }
+        result += source[i];
+    }
+    return result;
+}
+
+// Numbers between the braces of the initializer following `marker`,
+// identifiers like the casts in the GFXfont initializer are skipped
+static std::vector<long> initializerNumbers(const std::string& source, const std::string& marker) {
+    std::vector<long> numbers;
+    size_t i = source.find(marker);
+    if (i == std::string::npos) return numbers;
+    i = source.find('{', i);
+    if (i == std::string::npos) return numbers;
+
+    int depth = 0;
+    for (; i < source.size(); ++i) {
+        const char c = source[i];
+        if (c == '{') ++depth;
+        if (c == '}' && --depth == 0) break;
+
+        if (std::isalpha((unsigned char)c) || c == '_') {
+            while (i + 1 < source.size()
+                   && (std::isalnum((unsigned char)source[i + 1]) || source[i + 1] == '_')) {
+                ++i;
+            }
+        } else if (std::isdigit((unsigned char)c)
+                   || (c == '-' && i + 1 < source.size() && std::isdigit((unsigned char)source[i + 1]))) {
+            size_t length = 0;
+            numbers.push_back(std::stol(source.substr(i), &length, 0));
+            i += length - 1;
+        }
+    }
+    return numbers;
+}
+
+static bool parseFont(const std::string& source, Font& font) {
+    std::istringstream lines{source};
+    for (std::string line; std::getline(lines, line) && line.find("PROGMEM") == std::string::npos;) {
+        if (line.rfind("//", 0) == 0) font.comments += line + "\n";
+    }
+
+    const std::string code = stripComments(source);
+    for (long byte : initializerNumbers(code, "_bitmaps[]")) {
+        font.bitmaps.push_back(static_cast<unsigned char>(byte));
+    }
+
+    const std::vector<long> glyphs = initializerNumbers(code, "GFXglyph");
+    for (size_t i = 0; i + 6 <= glyphs.size(); i += 6) {
+        font.glyphs.push_back(Glyph{glyphs[i], glyphs[i + 1], glyphs[i + 2],
+                                    glyphs[i + 3], glyphs[i + 4], glyphs[i + 5]});
+    }
+
+    const std::vector<long> header = initializerNumbers(code, "const GFXfont");
+    if (header.size() != 3 || font.bitmaps.empty()
+        || font.glyphs.size() != static_cast<size_t>(header[1] - header[0] + 1)) {
+        return false;
+    }
+    font.first = header[0];
+    font.last = header[1];
+    font.y_advance = header[2];
+    return true;
+}
+
+static bool glyphPixel(const Font& font, const Glyph& glyph, long bit) {
+    return font.bitmaps[glyph.bitmap_offset + bit / 8] & (0x80 >> (bit % 8));
+}
+
+static std::vector<unsigned char> encodeRuns(const Font& font, const Glyph& glyph) {
+    std::vector<unsigned char> out;
+    auto emit = [&](long run) {
+        for (; run >= 255; run -= 255) out.push_back(255);
+        out.push_back(static_cast<unsigned char>(run));
+    };
+
+    bool set = false;
+    long run = 0;
+    for (long bit = 0; bit < glyph.width * glyph.height; ++bit) {
+        if (glyphPixel(font, glyph, bit) != set) {
+            emit(run);
+            set = !set;
+            run = 0;
+        }
+        ++run;
+    }
+    emit(run);
+    return out;
+}
+
+int main(int argc, const char* argv[]) {
+    if (argc != 5) {
+        std::cout << "Usage: ./font_subset gfx_font_source font_name characters out_file" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream in{argv[1]};
+    std::stringstream source;
+    source << in.rdbuf();
+
+    Font font;
+    if (!in || !parseFont(source.str(), font)) {
+        std::cout << "Cannot parse font: " << argv[1] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const std::string name = argv[2];
+    std::string chars = argv[3];
+    std::sort(chars.begin(), chars.end());
+    chars.erase(std::unique(chars.begin(), chars.end()), chars.end());
+
+    for (char c : chars) {
+        if (c < font.first || c > font.last) {
+            std::cout << "Character not in the font: '" << c << "'" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    const long first = chars.front();
+    const long last = chars.back();
+
+    std::vector<unsigned char> bitmaps;
+    std::ostringstream glyphs;
+    size_t original_size = 0;
+
+    for (long c = first; c <= last; ++c) {
+        const bool used = chars.find(static_cast<char>(c)) != std::string::npos;
+        Glyph glyph = font.glyphs[c - font.first];
+        if (!used) {
+            glyph = Glyph{0, 0, 0, 0, 0, 0};
+        }
+
+        const long bits = glyph.width * glyph.height;
+        const std::vector<unsigned char> runs = encodeRuns(font, glyph);
+        const bool use_runs = runs.size() < static_cast<size_t>((bits + 7) / 8);
+        original_size += (bits + 7) / 8;
+
+        const size_t offset = bitmaps.size();
+        if (use_runs) {
+            bitmaps.insert(bitmaps.end(), runs.begin(), runs.end());
+        } else {
+            bitmaps.insert(bitmaps.end(),
+                           font.bitmaps.begin() + glyph.bitmap_offset,
+                           font.bitmaps.begin() + glyph.bitmap_offset + (bits + 7) / 8);
+        }
+
+        glyphs << "  { " << std::setw(5) << offset << ", "
+               << std::setw(3) << glyph.width << ", " << std::setw(3) << glyph.height << ", "
+               << std::setw(3) << glyph.x_advance << ", " << std::setw(3) << glyph.x_offset << ", "
+               << std::setw(4) << glyph.y_offset << ", "
+               << (use_runs ? "GlyphEncoding::Runs" : "GlyphEncoding::Bits") << " }"
+               << (c == last ? " };" : ",  ");
+        if (used) {
+            glyphs << " // 0x" << std::hex << std::uppercase << c << std::dec << " '"
+                   << static_cast<char>(c) << "'";
+        } else {
+            glyphs << " // not used";
+        }
+        glyphs << "\n";
+    }
+
+    if (bitmaps.size() > UINT16_MAX) {
+        std::cout << "Font too big for 16-bit offsets" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::ofstream out{argv[4]};
+    out << "// Generated by tools/font_subset, do not edit\n"
+        << "#include <sys/pgmspace.h>\n"
+        << "#include \"fonts.hpp\"\n\n"
+        << font.comments << "\n"
+        << "const uint8_t " << name << "_bitmaps[] PROGMEM = {";
+
+    out << std::hex << std::uppercase << std::setfill('0');
+    for (size_t i = 0; i < bitmaps.size(); ++i) {
+        out << (i % 12 == 0 ? "\n  " : " ") << "0x" << std::setw(2) << unsigned{bitmaps[i]}
+            << (i + 1 < bitmaps.size() ? "," : "");
+    }
+    out << std::dec << std::nouppercase << std::setfill(' ') << " };\n\n";
+
+    out << "const PackedGlyph " << name << "_glyphs[] PROGMEM = {\n"
+        << glyphs.str() << "\n"
+        << "const PackedFont " << name << " PROGMEM = {\n"
+        << "  " << name << "_bitmaps,\n"
+        << "  " << name << "_glyphs,\n"
+        << "  0x" << std::hex << std::uppercase << first << ", 0x" << last << std::dec
+        << ", " << font.y_advance << " };\n\n"
+        << "// " << chars.size() << " glyphs, " << bitmaps.size() << " bytes of bitmaps, "
+        << original_size << " bytes bit-packed\n";
+
+    if (!out) {
+        std::cout << "Cannot write file: " << argv[4] << std::endl;
+        return EXIT_FAILURE;
+    }
+}
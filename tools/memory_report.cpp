@@ -0,0 +1,245 @@
+// Reports the static RAM and flash taken by each module, from the map file
+// the ESP8266 core writes next to the firmware, e.g. with arduino-cli:
+//   arduino-cli compile --build-path build ...
+//   ./memory_report build/rain-world-clock.ino.map
+// Objects of the sketch are listed one by one, archives (the core and the
+// libraries) as a whole, unless --members is given.
+// Build: g++ -std=c++2b -O2 tools/memory_report.cpp -o memory_report
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+enum class Area {
+    Data,       // initialized RAM, .data and .rodata, also stored in flash
+    Bss,        // zeroed RAM
+    Iram,       // code in the instruction RAM, also stored in flash
+    Irom,       // code and PROGMEM constants run and read from flash
+    None        // debug information and the like
+};
+
+struct Footprint {
+    uint64_t data = 0;
+    uint64_t bss = 0;
+    uint64_t iram = 0;
+    uint64_t irom = 0;
+
+    uint64_t ram() const { return data + bss; }
+    uint64_t flash() const { return data + iram + irom; }
+};
+
+struct MemoryRegion {
+    std::string name;
+    uint64_t origin;
+    uint64_t length;
+};
+
+static Area areaOf(const std::string& output_section) {
+    auto starts = [&](const char* prefix) { return output_section.rfind(prefix, 0) == 0; };
+    if (starts(".irom") || starts(".flash")) return Area::Irom;
+    if (starts(".text") || starts(".iram")) return Area::Iram;
+    if (starts(".bss") || starts(".noinit")) return Area::Bss;
+    if (starts(".data") || starts(".rodata") || starts(".dport0")) return Area::Data;
+    return Area::None;
+}
+
+static bool parseHex(const std::string& text, uint64_t& value) {
+    if (text.size() < 3 || text[0] != '0' || (text[1] != 'x' && text[1] != 'X')) {
+        return false;
+    }
+    size_t used = 0;
+    try {
+        value = std::stoull(text, &used, 16);
+    } catch (...) {
+        return false;
+    }
+    return used == text.size();
+}
+
+// "path/libfoo.a(bar.cpp.o)" is libfoo.a, or libfoo.a(bar.cpp) with members,
+// "path/sketch/config.cpp.o" is config.cpp
+static std::string moduleOf(const std::string& path, bool members) {
+    const size_t member = path.find('(');
+    std::string archive = path.substr(0, member);
+    archive = archive.substr(archive.find_last_of("/\\") + 1);
+
+    std::string object = member == std::string::npos
+        ? archive
+        : path.substr(member + 1, path.size() - member - 2);
+    if (object.size() > 2 && object.compare(object.size() - 2, 2, ".o") == 0) {
+        object.resize(object.size() - 2);
+    }
+
+    if (member == std::string::npos) return object;
+    return members ? archive + "(" + object + ")" : archive;
+}
+
+static std::vector<std::string> split(const std::string& line) {
+    std::vector<std::string> tokens;
+    std::istringstream in{line};
+    for (std::string token; in >> token;) {
+        tokens.push_back(token);
+    }
+    return tokens;
+}
+
+static void printRow(const std::string& name, const Footprint& f) {
+    std::cout << std::left << std::setw(40) << name << std::right
+              << std::setw(9) << f.data << std::setw(9) << f.bss
+              << std::setw(9) << f.ram() << std::setw(9) << f.iram
+              << std::setw(9) << f.irom << std::setw(10) << f.flash() << '\n';
+}
+
+int main(int argc, const char* argv[]) {
+    const bool members = argc == 3 && std::string{argv[2]} == "--members";
+    if (argc != 2 && !members) {
+        std::cout << "Usage: ./memory_report map_file [--members]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream in{argv[1]};
+    if (!in) {
+        std::cout << "Cannot open file: " << argv[1] << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::map<std::string, Footprint> modules;
+    std::vector<MemoryRegion> regions;
+    std::map<std::string, uint64_t> region_used;
+
+    enum { Preamble, Regions, Map } part = Preamble;
+    Area area = Area::None;
+    std::string pending_output;     // an output section name, the rest on the next line
+    std::string pending_input;      // the same for a long input section name
+
+    auto addInput = [&](const std::vector<std::string>& fields) {
+        // address, size, object
+        uint64_t address = 0, size = 0;
+        if (area == Area::None || fields.size() < 3
+            || !parseHex(fields[0], address) || !parseHex(fields[1], size) || size == 0) {
+            return;
+        }
+        std::string path = fields[2];
+        for (size_t i = 3; i < fields.size(); ++i) path += " " + fields[i];
+
+        Footprint& f = modules[moduleOf(path, members)];
+        switch (area) {
+            case Area::Data: f.data += size; break;
+            case Area::Bss:  f.bss += size; break;
+            case Area::Iram: f.iram += size; break;
+            case Area::Irom: f.irom += size; break;
+            case Area::None: break;
+        }
+        for (const MemoryRegion& region : regions) {
+            if (address >= region.origin && address < region.origin + region.length) {
+                region_used[region.name] += size;
+            }
+        }
+    };
+
+    for (std::string line; std::getline(in, line);) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+
+        if (line.rfind("Memory Configuration", 0) == 0) {
+            part = Regions;
+            continue;
+        }
+        if (line.rfind("Linker script and memory map", 0) == 0) {
+            part = Map;
+            continue;
+        }
+
+        const std::vector<std::string> tokens = split(line);
+        if (part == Regions) {
+            // name, origin, length, attributes
+            uint64_t origin = 0, length = 0;
+            if (tokens.size() >= 3 && parseHex(tokens[1], origin) && parseHex(tokens[2], length)
+                && tokens[0] != "*default*") {
+                regions.push_back(MemoryRegion{ tokens[0], origin, length });
+            }
+            continue;
+        }
+        if (part != Map || tokens.empty()) {
+            continue;
+        }
+
+        if (!pending_output.empty()) {
+            area = areaOf(pending_output);
+            pending_output.clear();
+            continue;
+        }
+        uint64_t address = 0;
+        if (!pending_input.empty() && parseHex(tokens[0], address)) {
+            addInput(tokens);
+            pending_input.clear();
+            continue;
+        }
+        pending_input.clear();
+
+        if (line[0] != ' ') {
+            // an output section, the address follows on the next line for long names
+            if (tokens[0][0] != '.') {
+                area = Area::None;
+            } else if (tokens.size() == 1) {
+                pending_output = tokens[0];
+            } else {
+                area = areaOf(tokens[0]);
+            }
+            continue;
+        }
+
+        // an input section: " .bss.name  address  size  object", the rest
+        // are symbols, fill and the patterns of the linker script
+        const bool input_section = line[1] != ' '
+                                   && (tokens[0][0] == '.' || tokens[0] == "COMMON");
+        if (!input_section) {
+            continue;
+        }
+        if (tokens.size() == 1) {
+            pending_input = tokens[0];
+        } else {
+            addInput(std::vector<std::string>(tokens.begin() + 1, tokens.end()));
+        }
+    }
+
+    std::vector<std::pair<std::string, Footprint>> sorted(modules.begin(), modules.end());
+    std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+        return a.second.ram() != b.second.ram()
+            ? a.second.ram() > b.second.ram()
+            : a.second.flash() > b.second.flash();
+    });
+
+    std::cout << std::left << std::setw(40) << "module" << std::right
+              << std::setw(9) << "data" << std::setw(9) << "bss"
+              << std::setw(9) << "RAM" << std::setw(9) << "IRAM"
+              << std::setw(9) << "IROM" << std::setw(10) << "flash" << '\n';
+
+    Footprint total;
+    for (const auto& [name, f] : sorted) {
+        printRow(name, f);
+        total.data += f.data;
+        total.bss += f.bss;
+        total.iram += f.iram;
+        total.irom += f.irom;
+    }
+    std::cout << '\n';
+    printRow("total", total);
+
+    if (!region_used.empty()) {
+        std::cout << '\n';
+    }
+    for (const MemoryRegion& region : regions) {
+        const auto used = region_used.find(region.name);
+        if (used == region_used.end()) continue;
+        std::cout << std::left << std::setw(20) << region.name << std::right
+                  << std::setw(9) << used->second << " of " << std::setw(9) << region.length
+                  << " bytes, " << std::fixed << std::setprecision(1)
+                  << 100.0 * used->second / region.length << "%\n";
+    }
+}
@@ -0,0 +1,114 @@
+// Host microbenchmark of the raster kernels against the byte loops they replaced.
+// Host compilers turn the byte fills into memset, on the ESP8266 they stay byte loops.
+// Build from the repository root:
+//   g++ -std=c++2b -O2 -I. tools/raster_bench.cpp raster_ops.cpp -o raster_bench
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+#include "raster_ops.hpp"
+
+namespace {
+
+constexpr int WIDTH = 800;
+constexpr int HEIGHT = 480;
+constexpr int PAGE_HEIGHT = 240;
+constexpr int STRIDE = WIDTH / 8;
+constexpr int PICTURE_WIDTH = 320;
+
+alignas(4) uint8_t page[STRIDE * PAGE_HEIGHT];
+alignas(4) uint8_t picture[PICTURE_WIDTH / 8 * PAGE_HEIGHT];
+
+// keeps the compiler from dropping the benchmarked loops
+uint32_t checksum() {
+    uint32_t sum = 0;
+    for (uint8_t byte : page) sum = sum * 31 + byte;
+    return sum;
+}
+
+// Each benchmark starts from the same random page, so the checksums of
+// a byte loop and of the kernel replacing it match only if they agree
+template <typename F>
+void run(const char* name, F&& f) {
+    std::mt19937 random{7};
+    for (uint8_t& byte : page) byte = (uint8_t)random();
+
+    constexpr int ITERATIONS = 2000;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) f();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const double us = std::chrono::duration<double, std::micro>(elapsed).count() / ITERATIONS;
+    std::cout << name << ": " << us << " us per page, checksum " << std::hex
+              << checksum() << std::dec << std::endl;
+}
+
+int getPixel(const uint8_t* row, int x) {
+    return (row[x / 8] >> (7 - x % 8)) & 1;
+}
+
+void setPixel(uint8_t* row, int x, int value) {
+    if (value) row[x / 8] |= 0x80 >> (x % 8);
+    else       row[x / 8] &= ~(0x80 >> (x % 8));
+}
+
+}  // namespace
+
+int main() {
+    std::mt19937 random{42};
+    for (uint8_t& byte : picture) byte = (uint8_t)random();
+
+    // the picture centered on the clock, at an odd x offset
+    constexpr int x0 = (HEIGHT - PICTURE_WIDTH) / 2 + 3;
+
+    run("blit, per pixel", [&] {
+        for (int y = 0; y < PAGE_HEIGHT; ++y) {
+            uint8_t* dst = page + y * STRIDE;
+            const uint8_t* src = picture + y * PICTURE_WIDTH / 8;
+            for (int x = 0; x < PICTURE_WIDTH; ++x) {
+                setPixel(dst, x0 + x, getPixel(dst, x0 + x) & getPixel(src, x));
+            }
+        }
+    });
+
+    run("blit, words", [&] {
+        for (int y = 0; y < PAGE_HEIGHT; ++y) {
+            blitRow(page + y * STRIDE, x0, picture + y * PICTURE_WIDTH / 8, 0,
+                    PICTURE_WIDTH, BlitMode::And);
+        }
+    });
+
+    run("masked blit, words", [&] {
+        for (int y = 0; y < PAGE_HEIGHT; ++y) {
+            const uint8_t* src = picture + y * PICTURE_WIDTH / 8;
+            blitRowMasked(page + y * STRIDE, x0, src, src, 0, PICTURE_WIDTH, BlitMode::Copy);
+        }
+    });
+
+    run("fill screen, bytes", [&] {
+        for (int i = 0; i < STRIDE * PAGE_HEIGHT; ++i) page[i] = 0xFF;
+    });
+
+    run("fill screen, words", [&] {
+        fillRect(page, STRIDE, 0, 0, WIDTH, PAGE_HEIGHT, solidPattern(true), BlitMode::Copy);
+    });
+
+    run("diffuse, bytes", [&] {
+        for (int y = 3; y < PAGE_HEIGHT; y += 4) {
+            for (int x = HEIGHT / 8; x < WIDTH / 8; ++x) {
+                page[y * STRIDE + x] |= 0b00010001;
+            }
+        }
+    });
+
+    run("diffuse, words", [&] {
+        const RowPattern pattern = repeatedBytePattern(0b00010001);
+        for (int y = 3; y < PAGE_HEIGHT; y += 4) {
+            fillRow(page + y * STRIDE, HEIGHT, WIDTH - HEIGHT, pattern, BlitMode::Or);
+        }
+    });
+
+    return 0;
+}